@@ -26,6 +26,7 @@
 #include <wx/intl.h>
 #include <wx/ipc.h>
 #include <wx/listctrl.h>
+#include <wx/menu.h>
 #ifdef __WXMSW__
     #include <wx/msw/private.h>
 #endif
@@ -33,7 +34,9 @@
 #include <wx/notebook.h>
 #include <wx/power.h>
 #include <wx/settings.h>
+#include <wx/srchctrl.h>
 #include <wx/stdpaths.h>
+#include <wx/stopwatch.h>
 #include <wx/sysopt.h>
 #include <wx/textfile.h>
 #include <wx/tglbtn.h>
@@ -54,12 +57,148 @@
 #ifdef __WXGTK__
     #include <gtk/gtk.h>
 #endif
+#ifdef __LINUX__
+    #include <climits>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <link.h>
+    #ifdef __GLIBC__
+        #include <execinfo.h>
+        #include <malloc.h>
+    #endif
+    #include <pthread.h>
+    #include <sched.h>
+    #include <signal.h>
+    #include <sys/statvfs.h>
+    #include <unistd.h>
+#endif
+#ifdef __UNIX__
+    #include <sys/resource.h>
+#endif
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <map>
 #include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    #include <cstdlib>
+    #include <new>
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
 
 #include "wxsysinfoframe.h"
 
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
+namespace { // anonymous namespace for the allocation counting
+
+// the number and total size of allocations
+struct AllocationCount
+{
+    wxULongLong_t count;
+    wxULongLong_t bytes;
+};
+
+// the allocations made by the current thread since it started,
+// counting only the main thread allocations excludes the helper threads
+thread_local AllocationCount threadAllocationCount;
+
+// Counts the allocations made by the current thread since the counter was created.
+class AllocationCounter
+{
+public:
+    AllocationCounter() : m_start(threadAllocationCount) {}
+
+    AllocationCount GetCount() const
+    {
+        return { threadAllocationCount.count - m_start.count, threadAllocationCount.bytes - m_start.bytes };
+    }
+private:
+    AllocationCount m_start;
+};
+
+} // anonymous namespace for the allocation counting
+
+// The replacements of the global allocation functions, counting the allocations.
+// They affect the whole application, so they should be used only for measurements.
+// Allocations not using operator new, e.g., those made by the native toolkit, are not counted.
+
+void* operator new(std::size_t size)
+{
+    ++threadAllocationCount.count;
+    threadAllocationCount.bytes += size;
+
+    if ( size == 0 )
+        size = 1;
+
+    for ( ;; )
+    {
+        void* p = std::malloc(size);
+
+        if ( p )
+            return p;
+
+        std::new_handler handler = std::get_new_handler();
+
+        if ( !handler )
+            throw std::bad_alloc();
+
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return ::operator new(size);
+    }
+    catch ( ... )
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
 namespace { // anonymous namespace for helper classes and functions
 
 wxString wxRectTowxString(const wxRect& r)
@@ -73,767 +212,1152 @@ wxString wxSizeTowxString(const wxSize& s)
     return wxString::Format(_("%d x %d"), s.x, s.y);
 }
 
+wxString BytesToString(wxULongLong_t bytes)
+{
+    return wxFileName::GetHumanReadableSize(wxULongLong(bytes));
+}
 
-/*************************************************
+// Formats the values into a fixed buffer and copies them into a string
+// reused between calls, so that refreshing the often updated values does not
+// allocate memory once the string has grown enough. Unlike wxRectTowxString()
+// and wxSizeTowxString(), the separators in the formatted values are not translated.
+class ValueFormatter
+{
+public:
+    const wxString& Int(wxLongLong_t value)
+    {
+        return Begin().AppendInt(value).End();
+    }
 
-    SysInfoListView
+    // same format as wxSizeTowxString()
+    const wxString& Size(const wxSize& s)
+    {
+        return Begin().AppendInt(s.x).Append(L" x ").AppendInt(s.y).End();
+    }
 
-*************************************************/
+    // same format as wxRectTowxString()
+    const wxString& Rect(const wxRect& r)
+    {
+        return Begin().AppendInt(r.GetLeft()).Append(L", ").AppendInt(r.GetTop()).Append(L"; ")
+                      .AppendInt(r.GetRight()).Append(L", ").AppendInt(r.GetBottom()).End();
+    }
 
-class SysInfoListView : public wxListView
-{
-public:
-    SysInfoListView(wxWindow* parent);
+    // same format as wxColour::GetAsString(wxC2S_CSS_SYNTAX)
+    const wxString& Colour(const wxColour& c)
+    {
+        if ( c.Alpha() == wxALPHA_OPAQUE )
+        {
+            return Begin().Append(L"rgb(").AppendInt(c.Red()).Append(L", ").AppendInt(c.Green())
+                          .Append(L", ").AppendInt(c.Blue()).Append(L")").End();
+        }
 
-    void UpdateValues();
-    void ShowDetailedInformation() const;
+        // the alpha is shown as a fraction with three decimal places, e.g. "0.502"
+        const int alpha = (c.Alpha() * 1000 + 127) / 255;
 
-    virtual bool CanShowDetailedInformation() const { return false; }
+        Begin().Append(L"rgba(").AppendInt(c.Red()).Append(L", ").AppendInt(c.Green())
+               .Append(L", ").AppendInt(c.Blue()).Append(L", 0.");
+        if ( alpha < 100 )
+            Append(L"0");
+        if ( alpha < 10 )
+            Append(L"0");
+        return AppendInt(alpha).Append(L")").End();
+    }
 
-    virtual wxArrayString GetValues(const wxString& separator = "\t") const = 0;
-protected:
-    std::map<long,int> m_columnWidths;
+private:
+    wchar_t  m_buffer[128];
+    size_t   m_length{0};
+    wxString m_string;
 
-    long AppendItemWithData(const wxString& label, long data);
+    ValueFormatter& Begin()
+    {
+        m_length = 0;
+        return *this;
+    }
 
-    virtual void DoUpdateValues() = 0;
-    virtual void DoShowDetailedInformation(long WXUNUSED(listItemIndex)) const {};
+    ValueFormatter& Append(const wchar_t* text)
+    {
+        while ( *text && m_length < WXSIZEOF(m_buffer) )
+            m_buffer[m_length++] = *text++;
+        return *this;
+    }
 
-    wxArrayString GetNameAndValueValues(int nameColumnIndex, int valueColumnIndex, const wxString& separator) const;
+    ValueFormatter& AppendInt(wxLongLong_t value)
+    {
+        wchar_t digits[24];
+        size_t digitCount = 0;
+        // negating the smallest value would overflow
+        wxULongLong_t absValue = value < 0 ? 0 - static_cast<wxULongLong_t>(value) : value;
 
-    void AutoSizeColumns();
+        do
+        {
+            digits[digitCount++] = L'0' + absValue % 10;
+            absValue /= 10;
+        } while ( absValue > 0 );
 
-    void OnColumnEndDrag(wxListEvent& event);
-    void OnItemActivated(wxListEvent& event);
+        if ( value < 0 )
+            digits[digitCount++] = L'-';
+
+        while ( digitCount > 0 && m_length < WXSIZEOF(m_buffer) )
+            m_buffer[m_length++] = digits[--digitCount];
+        return *this;
+    }
+
+    const wxString& End()
+    {
+        m_string.assign(m_buffer, m_length);
+        return m_string;
+    }
 };
 
-SysInfoListView::SysInfoListView(wxWindow* parent)
-    : wxListView(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL)
+#ifdef __LINUX__
+
+// Files in procfs and sysfs report their size as 0 (or as the page size),
+// so they must be read until EOF instead of relying on the reported size
+// as wxFile or wxTextFile do.
+bool ReadLinuxFile(const wxString& fileName, wxString& contents)
 {
-    Bind(wxEVT_LIST_COL_END_DRAG, &SysInfoListView::OnColumnEndDrag, this);
-    Bind(wxEVT_LIST_ITEM_ACTIVATED, &SysInfoListView::OnItemActivated, this);
+    FILE* file = fopen(fileName.fn_str(), "r");
+
+    if ( !file )
+        return false;
+
+    std::string buffer;
+    char chunk[4096];
+    size_t readCount;
+
+    while ( (readCount = fread(chunk, 1, sizeof(chunk), file)) > 0 )
+        buffer.append(chunk, readCount);
+
+    fclose(file);
+
+    contents = wxString::FromUTF8(buffer.data(), buffer.size());
+    return true;
 }
 
-void SysInfoListView::UpdateValues()
+// Returns the first line of the file without the trailing whitespace
+// or an empty string when the file could not be read.
+wxString ReadLinuxFileLine(const wxString& fileName)
 {
-    wxWindowUpdateLocker updateLocker(this);
+    wxString contents;
 
-    DoUpdateValues();
-    AutoSizeColumns();
+    if ( !ReadLinuxFile(fileName, contents) )
+        return wxEmptyString;
+
+    return contents.BeforeFirst('\n').Trim();
+}
+
+// Returns sorted numeric suffixes of the directory entries starting with prefix,
+// e.g. 0, 1, ..., 11 for "cpu" in "/sys/devices/system/cpu".
+std::vector<long> GetLinuxNumberedEntries(const wxString& dirName, const wxString& prefix)
+{
+    std::vector<long> numbers;
+    DIR* dir = opendir(dirName.fn_str());
+
+    if ( !dir )
+        return numbers;
 
-    if ( GetFirstSelected() == -1 && GetItemCount() > 0 )
+    while ( const dirent* entry = readdir(dir) )
     {
-        Select(0);
-        Focus(0);
+        const wxString name(entry->d_name);
+        wxString suffix;
+        long number = 0;
+
+        if ( name.StartsWith(prefix, &suffix) && suffix.ToLong(&number) )
+            numbers.push_back(number);
     }
+
+    closedir(dir);
+
+    std::sort(numbers.begin(), numbers.end());
+    return numbers;
 }
 
-void SysInfoListView::ShowDetailedInformation() const
+// Returns sorted names of the directory entries starting with prefix,
+// e.g. "hugepages-1048576kB", "hugepages-2048kB" for "hugepages-" in "/sys/kernel/mm/hugepages".
+std::vector<wxString> GetLinuxDirEntries(const wxString& dirName, const wxString& prefix)
 {
-    DoShowDetailedInformation(GetFirstSelected());
+    std::vector<wxString> names;
+    DIR* dir = opendir(dirName.fn_str());
+
+    if ( !dir )
+        return names;
+
+    while ( const dirent* entry = readdir(dir) )
+    {
+        const wxString name(entry->d_name);
+
+        if ( name != "." && name != ".." && name.StartsWith(prefix) )
+            names.push_back(name);
+    }
+
+    closedir(dir);
+
+    std::sort(names.begin(), names.end());
+    return names;
 }
 
-long SysInfoListView::AppendItemWithData(const wxString& label, long data)
+// Returns the number of entries in the directory, not counting "." and "..",
+// or -1 if the directory could not be opened.
+long GetLinuxDirEntryCount(const wxString& dirName)
 {
-    const long itemIndex = InsertItem(GetItemCount(), label);
+    DIR* dir = opendir(dirName.fn_str());
 
-    if ( itemIndex == -1 )
-        wxLogError(_("Could not insert item with label '%s'"), label);
-    else
-        SetItemData(itemIndex, data);
+    if ( !dir )
+        return -1;
 
-    return itemIndex;
+    long count = 0;
+
+    while ( const dirent* entry = readdir(dir) )
+    {
+        if ( strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0 )
+            ++count;
+    }
+
+    closedir(dir);
+    return count;
 }
 
-wxArrayString SysInfoListView::GetNameAndValueValues(int nameColumnIndex, int valueColumnIndex, const wxString& separator) const
+// Parses the list format used by the kernel for CPUs and NUMA nodes, e.g. "0-3,8,10-11".
+std::set<long> ParseLinuxCPUList(const wxString& list)
 {
-    const int itemCount = GetItemCount();
+    const wxArrayString ranges = wxSplit(list, ',', '\0');
+    std::set<long> numbers;
 
-    wxArrayString values;
+    for ( const auto& range : ranges )
+    {
+        long first = 0, last = 0;
 
-    values.reserve(itemCount + 1);
+        if ( !range.BeforeFirst('-').ToLong(&first) )
+            continue;
 
-    // column headings
-    values.push_back(wxString::Format(wxS("%s%s%s"), _("Name"), separator, _("Value")));
+        if ( !range.AfterFirst('-').ToLong(&last) )
+            last = first;
 
-    // dump values
-    for ( int i = 0; i < itemCount; ++i )
-    {
-        values.push_back(wxString::Format(wxS("%s%s%s"),
-            GetItemText(i, nameColumnIndex),
-            separator,
-            GetItemText(i, valueColumnIndex)));
+        for ( long number = first; number <= last; ++number )
+            numbers.insert(number);
     }
 
-    return values;
+    return numbers;
 }
 
-void SysInfoListView::AutoSizeColumns()
+// The opposite of ParseLinuxCPUList().
+wxString FormatLinuxCPUList(const std::set<long>& numbers)
 {
-    const int columnCount = GetColumnCount();
+    wxString list;
 
-    for ( int i = 0; i < columnCount; ++i )
+    for ( auto it = numbers.begin(); it != numbers.end(); )
     {
-        const auto it = m_columnWidths.find(i);
+        const long first = *it;
+        long last = first;
 
-        if ( it != m_columnWidths.end() )
-            SetColumnWidth(i, it->second);
+        while ( ++it != numbers.end() && *it == last + 1 )
+            last = *it;
+
+        if ( !list.empty() )
+            list += ',';
+
+        if ( first == last )
+            list += wxString::Format("%ld", first);
         else
-            SetColumnWidth(i, wxLIST_AUTOSIZE);
+            list += wxString::Format("%ld-%ld", first, last);
     }
+
+    return list;
 }
 
-void SysInfoListView::OnColumnEndDrag(wxListEvent& event)
+// Returns the option in brackets from sysfs files listing all the options
+// with the selected one in brackets, e.g. "madvise" for "always [madvise] never".
+wxString GetLinuxSelectedOption(const wxString& options)
 {
-    event.Skip();
-    m_columnWidths[event.GetColumn()] = GetColumnWidth(event.GetColumn());
+    const wxString selected = options.AfterFirst('[').BeforeFirst(']');
+
+    return selected.empty() ? options : selected;
 }
 
-void SysInfoListView::OnItemActivated(wxListEvent& event)
+bool GetLinuxProcessCPUAffinity(std::set<long>& CPUs)
 {
-    DoShowDetailedInformation(event.GetIndex());
+    cpu_set_t CPUSet;
+
+    CPU_ZERO(&CPUSet);
+    if ( sched_getaffinity(0, sizeof(CPUSet), &CPUSet) != 0 )
+        return false;
+
+    for ( long cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+    {
+        if ( CPU_ISSET(cpu, &CPUSet) )
+            CPUs.insert(cpu);
+    }
+
+    return true;
 }
 
+// Parses files in the /proc/meminfo format ("Name: value [kB]"), also accepting
+// the "Node N " prefix used by /sys/devices/system/node/nodeN/meminfo.
+// The values are returned as they are, i.e., mostly in KiB.
+std::map<wxString, wxULongLong_t> ParseLinuxMemInfo(const wxString& fileName)
+{
+    std::map<wxString, wxULongLong_t> values;
+    wxString contents;
 
-/*************************************************
+    if ( !ReadLinuxFile(fileName, contents) )
+        return values;
 
-    SystemSettingView
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        const wxString name = line.BeforeFirst(':').AfterLast(' ');
+        wxULongLong_t value = 0;
 
-*************************************************/
+        if ( !name.empty() && line.AfterFirst(':').Trim(false).BeforeFirst(' ').ToULongLong(&value) )
+            values[name] = value;
+    }
 
-class SystemSettingView : public SysInfoListView
+    return values;
+}
+
+// Parses files with a name and value on each line, such as /proc/self/status ("Name:\tvalue")
+// or cgroup cpu.stat ("name value"); separator is the character separating the two.
+std::map<wxString, wxString> ParseLinuxNameValueFile(const wxString& fileName, char separator)
 {
-public:
-    SystemSettingView(wxWindow* parent);
+    std::map<wxString, wxString> values;
+    wxString contents;
 
-    wxArrayString GetValues(const wxString& separator) const override
+    if ( !ReadLinuxFile(fileName, contents) )
+        return values;
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
     {
-        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+        wxString value;
+        wxString name = line.BeforeFirst(separator, &value);
+
+        if ( !name.Trim().empty() )
+            values[name] = value.Trim(false).Trim();
     }
-protected:
-    enum
-    {
-        Column_Name = 0,
-        Column_Value,
-        Column_Description
-    };
-};
 
-SystemSettingView::SystemSettingView(wxWindow* parent)
-    : SysInfoListView(parent)
-{
-    InsertColumn(Column_Name, _("Name"));
-    InsertColumn(Column_Value, _("Value"));
-    InsertColumn(Column_Description, _("Description"));
+    return values;
 }
 
+struct LinuxMountInfo
+{
+    wxString mountPoint;
+    wxString type;
+    wxString source;
+    wxString options; // per-mount options, e.g. "rw,noatime"
+};
 
-/*************************************************
+// Parses /proc/self/mountinfo, see proc(5) for the format, e.g.
+// "36 35 98:0 /mnt1 /mnt2 rw,noatime master:1 - ext3 /dev/root rw,errors=continue".
+std::vector<LinuxMountInfo> ParseLinuxMountInfo()
+{
+    std::vector<LinuxMountInfo> mounts;
+    wxString contents;
 
-    SystemColourView
+    // spaces and some other characters in paths are escaped as octal numbers
+    auto unescape = [](wxString s)
+    {
+        s.Replace("\\040", " ");
+        s.Replace("\\011", "\t");
+        s.Replace("\\012", "\n");
+        s.Replace("\\134", "\\");
+        return s;
+    };
 
-*************************************************/
+    if ( !ReadLinuxFile("/proc/self/mountinfo", contents) )
+        return mounts;
 
-class SystemColourView : public SystemSettingView
-{
-public:
-    SystemColourView(wxWindow* parent);
-    ~SystemColourView();
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        // the number of optional fields before the " - " separator varies
+        const int separatorPos = line.Find(" - ");
 
-    bool CanShowDetailedInformation() const override { return GetFirstSelected() != -1; }
+        if ( separatorPos == wxNOT_FOUND )
+            continue;
 
-    void SetColourBitmapOutlineColour(const wxColour& outlineColour);
-    wxColour GetColourBitmapOutlineColour() const { return m_outlineColour; }
+        const wxArrayString fields = wxSplit(line.Left(separatorPos), ' ', '\0');
+        const wxArrayString superBlock = wxSplit(line.Mid(separatorPos + 3), ' ', '\0');
+        LinuxMountInfo mount;
 
-    static wxColour GetDefaultColourBitmapOutlineColour();
-protected:
-    void DoUpdateValues() override;
-    void DoShowDetailedInformation(long listItemIndex) const override;
-private:
-    wxImageList* m_imageList{nullptr};
-    wxColour m_outlineColour;
-    std::set<wxSystemColour> m_deprecatedColourList;
+        if ( fields.size() < 6 || superBlock.size() < 2 )
+            continue;
 
-    wxBitmap CreateColourBitmap(const wxColour& colour, const wxSize& size);
+        mount.mountPoint = unescape(fields[4]);
+        mount.options    = fields[5];
+        mount.type       = superBlock[0];
+        mount.source     = unescape(superBlock[1]);
 
-    void CreateDeprecatedColourList();
-    bool IsDeprecatedSystemColour(wxSystemColour index);
-};
+        mounts.push_back(mount);
+    }
 
-struct ColourInfo
+    return mounts;
+}
+
+// Returns the mount containing the absolute path or nullptr if not found.
+const LinuxMountInfo* FindLinuxMount(const std::vector<LinuxMountInfo>& mounts, const wxString& path)
 {
-    wxSystemColour index;
-    const char*    name;
-    const char*    description;
-};
+    const LinuxMountInfo* result = nullptr;
 
-ColourInfo const s_colourInfoArray[] =
+    // the longest matching mount point wins, among the same ones
+    // the last one, as it is mounted over the previous ones
+    for ( const auto& mount : mounts )
+    {
+        const wxString& mountPoint = mount.mountPoint;
+        const bool matches = mountPoint == "/"
+                             || path == mountPoint
+                             || path.StartsWith(mountPoint + "/");
+
+        if ( matches && (!result || mountPoint.length() >= result->mountPoint.length()) )
+            result = &mount;
+    }
+
+    return result;
+}
+
+// Returns true for the network and FUSE filesystems, where accessing the files
+// or even calling statvfs() can block for a long time, and for autofs,
+// where it triggers mounting.
+bool IsLinuxRemoteOrAutoFilesystem(const wxString& type)
 {
-    wxSYS_COLOUR_SCROLLBAR, "wxSYS_COLOUR_SCROLLBAR", "The scrollbar grey area.",
-    wxSYS_COLOUR_DESKTOP, "wxSYS_COLOUR_DESKTOP", "The desktop colour.",
-    wxSYS_COLOUR_ACTIVECAPTION, "wxSYS_COLOUR_ACTIVECAPTION", "Active window caption colour.",
-    wxSYS_COLOUR_INACTIVECAPTION, "wxSYS_COLOUR_INACTIVECAPTION", "Inactive window caption colour.",
-    wxSYS_COLOUR_MENU, "wxSYS_COLOUR_MENU", "Menu background colour.",
-    wxSYS_COLOUR_WINDOW, "wxSYS_COLOUR_WINDOW", "Window background colour.",
-    wxSYS_COLOUR_WINDOWFRAME, "wxSYS_COLOUR_WINDOWFRAME", "Window frame colour.",
-    wxSYS_COLOUR_MENUTEXT, "wxSYS_COLOUR_MENUTEXT", "Colour of the text used in the menus.",
-    wxSYS_COLOUR_WINDOWTEXT, "wxSYS_COLOUR_WINDOWTEXT", "Colour of the text used in generic windows.",
-    wxSYS_COLOUR_CAPTIONTEXT, "wxSYS_COLOUR_CAPTIONTEXT", "Colour of the text used in captions, size boxes and scrollbar arrow boxes.",
-    wxSYS_COLOUR_ACTIVEBORDER, "wxSYS_COLOUR_ACTIVEBORDER", "Active window border colour.",
-    wxSYS_COLOUR_INACTIVEBORDER, "wxSYS_COLOUR_INACTIVEBORDER", "Inactive window border colour.",
-    wxSYS_COLOUR_APPWORKSPACE, "wxSYS_COLOUR_APPWORKSPACE", "Background colour for MDI applications.",
-    wxSYS_COLOUR_HIGHLIGHT, "wxSYS_COLOUR_HIGHLIGHT", "Colour of item(s) selected in a control.",
-    wxSYS_COLOUR_HIGHLIGHTTEXT, "wxSYS_COLOUR_HIGHLIGHTTEXT", "Colour of the text of item(s) selected in a control.",
-    wxSYS_COLOUR_BTNFACE, "wxSYS_COLOUR_BTNFACE", "Face shading colour on push buttons.",
-    wxSYS_COLOUR_BTNSHADOW, "wxSYS_COLOUR_BTNSHADOW", "Edge shading colour on push buttons.",
-    wxSYS_COLOUR_GRAYTEXT, "wxSYS_COLOUR_GRAYTEXT", "Colour of greyed (disabled) text.",
-    wxSYS_COLOUR_BTNTEXT, "wxSYS_COLOUR_BTNTEXT", "Colour of the text on push buttons.",
-    wxSYS_COLOUR_INACTIVECAPTIONTEXT, "wxSYS_COLOUR_INACTIVECAPTIONTEXT", "Colour of the text in active captions.",
-    wxSYS_COLOUR_BTNHIGHLIGHT, "wxSYS_COLOUR_BTNHIGHLIGHT", "Highlight colour for buttons.",
-    wxSYS_COLOUR_3DDKSHADOW, "wxSYS_COLOUR_3DDKSHADOW", "Dark shadow colour for three-dimensional display elements.",
-    wxSYS_COLOUR_3DLIGHT, "wxSYS_COLOUR_3DLIGHT", "Light colour for three-dimensional display elements.",
-    wxSYS_COLOUR_INFOTEXT, "wxSYS_COLOUR_INFOTEXT", "Text colour for tooltip controls.",
-    wxSYS_COLOUR_INFOBK, "wxSYS_COLOUR_INFOBK", "Background colour for tooltip controls.",
-    wxSYS_COLOUR_LISTBOX, "wxSYS_COLOUR_LISTBOX", "Background colour for list-like controls.",
-    wxSYS_COLOUR_HOTLIGHT, "wxSYS_COLOUR_HOTLIGHT", "Colour for a hyperlink or hot-tracked item.",
-    wxSYS_COLOUR_GRADIENTACTIVECAPTION, "wxSYS_COLOUR_GRADIENTACTIVECAPTION", "Right side colour in the color gradient of an active window's title bar.",
-    wxSYS_COLOUR_GRADIENTINACTIVECAPTION, "wxSYS_COLOUR_GRADIENTINACTIVECAPTION", "Right side colour in the color gradient of an inactive window's title bar.",
-    wxSYS_COLOUR_MENUHILIGHT, "wxSYS_COLOUR_MENUHILIGHT", "The colour used to highlight menu items when the menu appears as a flat menu.",
-    wxSYS_COLOUR_MENUBAR, "wxSYS_COLOUR_MENUBAR", "The background colour for the menu bar when menus appear as flat menus.",
-    wxSYS_COLOUR_LISTBOXTEXT, "wxSYS_COLOUR_LISTBOXTEXT", "Text colour for list-like controls.",
-    wxSYS_COLOUR_LISTBOXHIGHLIGHTTEXT, "wxSYS_COLOUR_LISTBOXHIGHLIGHTTEXT", "Text colour for the unfocused selection of list-like controls.",
-    wxSYS_COLOUR_BACKGROUND, "wxSYS_COLOUR_BACKGROUND", "Synonym for wxSYS_COLOUR_DESKTOP.",
-    wxSYS_COLOUR_3DFACE, "wxSYS_COLOUR_3DFACE", "Synonym for wxSYS_COLOUR_BTNFACE.",
-    wxSYS_COLOUR_3DSHADOW, "wxSYS_COLOUR_3DSHADOW", "Synonym for wxSYS_COLOUR_BTNSHADOW.",
-    wxSYS_COLOUR_BTNHILIGHT, "wxSYS_COLOUR_BTNHILIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
-    wxSYS_COLOUR_3DHIGHLIGHT, "wxSYS_COLOUR_3DHIGHLIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
-    wxSYS_COLOUR_3DHILIGHT, "wxSYS_COLOUR_3DHILIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
-    wxSYS_COLOUR_FRAMEBK, "wxSYS_COLOUR_FRAMEBK", "Synonym for wxSYS_COLOUR_BTNFACE.",
-};
+    static const char* const types[] =
+    {
+        "autofs", "nfs", "nfs4", "cifs", "smb3", "smbfs", "ncpfs", "9p",
+        "afs", "ceph", "glusterfs", "lustre", "davfs", "fuse", "fuseblk",
+    };
 
-SystemColourView::SystemColourView(wxWindow* parent)
-    : SystemSettingView(parent)
-{
-    CreateDeprecatedColourList();
+    for ( const char* t : types )
+    {
+        if ( type == t )
+            return true;
+    }
 
-    SetColourBitmapOutlineColour(GetDefaultColourBitmapOutlineColour());
+    return type.StartsWith("fuse.");
+}
 
-    for ( size_t i = 0; i < WXSIZEOF(s_colourInfoArray); ++i )
+// Returns true for the filesystems without storage, such as proc or sysfs.
+bool IsLinuxPseudoFilesystem(const wxString& type)
+{
+    static const char* const types[] =
     {
-        if ( IsDeprecatedSystemColour(s_colourInfoArray[i].index) )
-            continue;
-
-         const wxString colourName = s_colourInfoArray[i].name;
-         const wxString colourDescription = s_colourInfoArray[i].description;
-         const long itemIndex = InsertItem(i, colourName, -1);
+        "proc", "sysfs", "cgroup", "cgroup2", "devpts", "mqueue", "debugfs",
+        "tracefs", "securityfs", "pstore", "bpf", "configfs", "fusectl",
+        "hugetlbfs", "binfmt_misc", "efivarfs", "rpc_pipefs", "nsfs", "selinuxfs",
+    };
 
-         if ( itemIndex != -1 )
-         {
-             SetItem(itemIndex, Column_Description, colourDescription);
-             SetItemData(itemIndex, (long)i);
-         }
+    for ( const char* t : types )
+    {
+        if ( type == t )
+            return true;
     }
 
-    UpdateValues();
+    return false;
 }
 
-SystemColourView::~SystemColourView()
-{
-    if ( m_imageList )
-        delete m_imageList;
-}
+#endif // #ifdef __LINUX__
 
-void SystemColourView::SetColourBitmapOutlineColour(const wxColour& outlineColour)
-{
-    m_outlineColour = outlineColour;
-    UpdateValues();
-}
 
-wxColour SystemColourView::GetDefaultColourBitmapOutlineColour()
-{
-    const wxColour defaultOutlineColour(202, 31, 123); // magenta
 
-    return defaultOutlineColour;
-}
+/*************************************************
 
-void SystemColourView::DoUpdateValues()
+    SysInfoListView
+
+*************************************************/
+
+class SysInfoListView : public wxListView
 {
-    wxSize size;
+public:
+    SysInfoListView(wxWindow* parent);
 
-    if ( m_imageList )
+    // how often the values in a row can change, used as flags
+    enum Volatility
     {
-        SetImageList(nullptr, wxIMAGE_LIST_SMALL);
-        delete m_imageList;
-    }
+        // cannot change while the application is running
+        Volatility_Constant = 1 << 0,
+        // can change in response to a system setting change or the application
+        Volatility_OnEvent  = 1 << 1,
+        // can change any time, e.g., resource usage
+        Volatility_Live     = 1 << 2,
+
+        Volatility_All      = Volatility_Constant | Volatility_OnEvent | Volatility_Live,
+    };
 
-    m_imageList = new wxImageList();
+    // refreshes only the rows with the given volatilities,
+    // the constant rows are populated only once
+    void UpdateValues(int volatilities = Volatility_All);
+    void ShowDetailedInformation() const;
 
-    size.SetWidth(wxSystemSettings::GetMetric(wxSYS_SMALLICON_X, this));
-    size.SetHeight(wxSystemSettings::GetMetric(wxSYS_SMALLICON_Y, this));
+    // the volatilities of the rows in the view
+    virtual int GetVolatilities() const { return Volatility_OnEvent; }
 
-    // work around wxSystemSettings::GetMetric(wxSYS_SMALLICON_{X|Y}) value
-    // being unavailable
-    if ( !size.IsFullySpecified() )
+    // the interval in milliseconds in which the live values are refreshed while
+    // the view is shown, 0 means they are not refreshed; in the live refresh mode,
+    // also the views which do not sample their values on their own are refreshed
+    virtual int GetSampleInterval(bool liveRefresh) const
     {
-        size.Set(16, 16);
-#if wxCHECK_VERSION(3, 1, 0)
-        size = FromDIP(size);
-#endif
+        return liveRefresh && (GetVolatilities() & Volatility_Live) ? LiveRefreshSampleInterval : 0;
     }
 
-    m_imageList->Create(size.GetWidth(), size.GetHeight(), false);
-    SetImageList(m_imageList, wxIMAGE_LIST_SMALL);
+    // called periodically by wxSystemInformationFrame while the view is shown,
+    // refreshes the live values when the interval elapsed since the last refresh,
+    // the time and interval are in milliseconds
+    void SampleValues(wxLongLong_t time, int interval);
+
+    static const int LiveRefreshSampleInterval = 2000;
+
+    // returns the index of the first item at or after startItemIndex shown
+    // with the current filter and containing the text in any of its columns,
+    // ignoring case, or -1 if there is none; the text must be lower case
+    long FindItemWithText(const wxString& lowerCaseText, long startItemIndex) const;
+
+    // shows only the items containing the filter in any of their columns,
+    // ignoring case; an empty filter shows all the items
+    void SetFilter(const wxString& filter);
+    wxString GetFilter() const { return m_filter; }
+
+    // The view is a virtual list control showing the items matching the filter
+    // from those stored in the view, so the filter can be changed without
+    // recreating the native items. The functions below work with the stored
+    // items and their indices are the indices of all the items, while
+    // the wxListView functions work with the shown items only.
+
+    // returns the index of the added item
+    long AddStoredItem(const wxString& label);
+    void SetStoredItem(long index, int column, const wxString& label, int imageId = -1);
+    void SetStoredItemColumnImage(long index, int column, int imageId);
+    wxString GetStoredItemText(long index, int column = 0) const;
+    void SetStoredItemData(long index, long data);
+    long GetStoredItemData(long index) const;
+    long FindStoredItem(long start, long data) const;
+    void DeleteAllStoredItems();
+    int GetStoredItemCount() const { return static_cast<int>(m_items.size()); }
+
+    long GetFirstSelectedStoredItem() const;
+    void SelectStoredItem(long index, bool on = true);
+    void FocusStoredItem(long index);
 
-    const int itemCount = GetItemCount();
+    virtual bool CanShowDetailedInformation() const { return false; }
 
-    for ( int i = 0; i < itemCount; ++i )
-    {
-         const wxColour colour = wxSystemSettings::GetColour(s_colourInfoArray[GetItemData(i)].index);
-         const int imageIndex = m_imageList->Add(CreateColourBitmap(colour.IsOk() ? colour : GetColourBitmapOutlineColour(), size));
-         wxString colourValue = _("<Invalid>");
+    virtual wxArrayString GetValues(const wxString& separator = "\t") const = 0;
 
-         if ( colour.IsOk() )
-         {
-             colourValue = colour.GetAsString(wxC2S_CSS_SYNTAX);
+    // the wxSystemInformationFrame::CreateFlags View* value of the view
+    void SetViewFlag(long viewFlag) { m_viewFlag = viewFlag; }
+    long GetViewFlag() const { return m_viewFlag; }
 
-             if ( !colour.IsSolid() )
-                 colourValue += _(", not solid");
-         }
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    // the allocations made by the last DoUpdateValues() call
+    AllocationCount GetUpdateValuesAllocationCount() const { return m_updateValuesAllocationCount; }
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+protected:
+    std::map<long,int> m_columnWidths;
+    ValueFormatter     m_valueFormatter;
 
-         SetItem(i, Column_Value, colourValue, imageIndex);
-    }
+    long AppendItemWithData(const wxString& label, long data);
+    // for views with the name and value in the first two columns
+    long AppendItemWithValue(const wxString& label, const wxString& value);
+    // For views rebuilding their items on each update: the items are the item
+    // data and the texts of the columns. When the data and first column texts
+    // of the items did not change, only the changed texts are updated in place,
+    // so that the selection, scroll position, and measured widths are preserved;
+    // otherwise the items are recreated and the selected item is kept selected.
+    void SetStoredItems(const std::vector<std::pair<long, wxArrayString>>& items);
+    // for views with the name and value in the first two columns
+    void SetItemsWithValues(const std::vector<std::pair<wxString, wxString>>& items);
+
+    virtual void DoUpdateValues() = 0;
+    virtual void DoShowDetailedInformation(long WXUNUSED(listItemIndex)) const {};
+
+    // whether DoUpdateValues() is to refresh the rows with the given volatility,
+    // views with rows of different volatilities skip the other rows
+    bool IsUpdatingVolatility(Volatility volatility) const { return (m_updatingVolatilities & volatility) != 0; }
+
+    wxArrayString GetNameAndValueValues(int nameColumnIndex, int valueColumnIndex, const wxString& separator) const;
+    wxArrayString GetAllColumnsValues(const wxString& separator) const;
+
+    void AutoSizeColumns();
+
+    wxString OnGetItemText(long item, long column) const override;
+    int OnGetItemImage(long item) const override;
+    int OnGetItemColumnImage(long item, long column) const override;
+
+    void OnColumnEndDrag(wxListEvent& event);
+    void OnItemActivated(wxListEvent& event);
+
+private:
+    struct Item
+    {
+        std::vector<wxString> texts;
+        std::vector<int>      images;
+        long                  data{0};
+
+        // the lower case texts of the columns separated by tabs,
+        // used for filtering and searching, built when needed
+        mutable wxString searchText;
+        mutable bool     searchTextValid{false};
+        // the widths of the column texts in pixels, measured when needed
+        mutable std::vector<int> textWidths;
+
+        void SetText(int column, const wxString& text);
+        void SetImage(int column, int imageId);
+    };
+
+    std::vector<Item> m_items;
+    // the ascending indices of the items matching the filter,
+    // the index of an item in m_shownItems is its index in the list control
+    std::vector<long> m_shownItems;
+    wxString          m_filter; // lower case
+    // the items were added or deleted during DoUpdateValues() or the items
+    // matching the filter changed, m_shownItems is to be rebuilt
+    bool              m_shownItemsStale{false};
+    bool              m_itemsDeleted{false};
+    // the item to select after m_shownItems is rebuilt
+    long              m_itemToSelect{-1};
+    // the character width when the item text widths were measured,
+    // they are measured again when the font or DPI changed
+    int               m_measuredCharWidth{0};
+
+    // the timer scheduling the samples may fire a bit early
+    static const int SampleTimeTolerance = 50;
+
+    long         m_viewFlag{0};
+    bool         m_valuesPopulated{false};
+    int          m_updatingVolatilities{Volatility_All};
+    wxLongLong_t m_nextSampleTime{0};
+
+    bool              m_updatingValues{false};
+
+    const wxString& GetSearchText(const Item& item) const;
+    bool MatchesFilter(const Item& item) const;
+    // returns the index of the item in the list control or -1 if it is not shown
+    long GetShownIndex(long index) const;
+    // refreshes the shown item after its texts or images changed
+    void OnStoredItemChanged(long index);
+    void UpdateShownItems();
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    AllocationCount m_updateValuesAllocationCount{0, 0};
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+};
+
+SysInfoListView::SysInfoListView(wxWindow* parent)
+    : wxListView(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL | wxLC_VIRTUAL)
+{
+    Bind(wxEVT_LIST_COL_END_DRAG, &SysInfoListView::OnColumnEndDrag, this);
+    Bind(wxEVT_LIST_ITEM_ACTIVATED, &SysInfoListView::OnItemActivated, this);
 }
 
-void SystemColourView::DoShowDetailedInformation(long listItemIndex) const
+void SysInfoListView::UpdateValues(int volatilities)
 {
-    const size_t infoArrayIndex = GetItemData(listItemIndex);
-    const wxString valueName = s_colourInfoArray[infoArrayIndex].name;
-    const wxColour colour = wxSystemSettings::GetColour(s_colourInfoArray[infoArrayIndex].index);
+    const bool firstUpdate = !m_valuesPopulated;
 
-    if ( !colour.IsOk() )
+    if ( m_valuesPopulated )
+        volatilities &= ~Volatility_Constant;
+    else
+        volatilities = Volatility_All;
+
+    if ( (volatilities & GetVolatilities()) == 0 )
     {
-        wxLogError(_("Invalid colour for \"%s\"."), valueName);
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+        m_updateValuesAllocationCount = AllocationCount{0, 0};
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
         return;
     }
 
-    wxColourData colourData;
+    wxWindowUpdateLocker updateLocker(this);
 
-    colourData.SetCustomColour(0, colour);
+    m_updatingVolatilities = volatilities;
+    m_updatingValues = true;
 
-    wxGetColourFromUser(GetParent(), colour, wxString::Format(_("Viewing %s"), valueName), &colourData);
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    AllocationCounter allocationCounter;
+
+    DoUpdateValues();
+    m_updateValuesAllocationCount = allocationCounter.GetCount();
+#else
+    DoUpdateValues();
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    m_updatingValues = false;
+    m_valuesPopulated = true;
+
+    const bool shownItemsChanged = m_shownItemsStale;
+
+    // only the values of the shown items changed
+    if ( shownItemsChanged )
+        UpdateShownItems();
+    else
+        Refresh();
+
+    // the columns do not change their widths under the user with each sample
+    // or live refresh, only when the shown items changed
+    if ( firstUpdate || shownItemsChanged || (volatilities & GetVolatilities() & ~Volatility_Live) != 0 )
+        AutoSizeColumns();
+
+    if ( GetFirstSelectedStoredItem() == -1 && !m_shownItems.empty() )
+    {
+        SelectStoredItem(m_shownItems[0]);
+        FocusStoredItem(m_shownItems[0]);
+    }
 }
 
-wxBitmap SystemColourView::CreateColourBitmap(const wxColour& colour, const wxSize& size)
+long SysInfoListView::FindItemWithText(const wxString& lowerCaseText, long startItemIndex) const
 {
-    wxBitmap bitmap(size);
-    wxMemoryDC memoryDC(bitmap);
-    wxBrush brush(colour);
-    wxPen pen(m_outlineColour, FromDIP(1));
-    wxDCPenChanger penChanger(memoryDC, pen);
-    wxDCBrushChanger brushChanger(memoryDC, brush);
+    auto it = std::lower_bound(m_shownItems.begin(), m_shownItems.end(), startItemIndex);
 
-    memoryDC.DrawRectangle(wxRect(size));
-    memoryDC.SelectObject(wxNullBitmap);
+    for ( ; it != m_shownItems.end(); ++it )
+    {
+        if ( GetSearchText(m_items[*it]).find(lowerCaseText) != wxString::npos )
+            return *it;
+    }
 
-    return bitmap;
+    return -1;
 }
 
-void SystemColourView::CreateDeprecatedColourList()
+void SysInfoListView::SetFilter(const wxString& filter)
 {
-#ifdef __WXMSW__
-// most system colors are deprecated in Windows 10 and newer
-// see https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-getsyscolor
+    const wxString lowerCaseFilter = filter.Lower();
 
-    int verMajor = 0;
+    if ( lowerCaseFilter == m_filter )
+        return;
 
-    wxGetOsVersion(&verMajor);
+    m_filter = lowerCaseFilter;
+    m_shownItemsStale = true;
+    UpdateShownItems();
+    AutoSizeColumns();
+}
 
-    if ( verMajor < 10 )
-        return;
+long SysInfoListView::AddStoredItem(const wxString& label)
+{
+    const long index = GetStoredItemCount();
 
-    wxCHECK_RET(m_deprecatedColourList.empty(), "list already created");
+    m_items.emplace_back();
+    m_items.back().SetText(0, label);
 
-    m_deprecatedColourList.insert(wxSYS_COLOUR_3DDKSHADOW);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_3DHIGHLIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_3DHILIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_3DLIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_3DSHADOW);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_ACTIVEBORDER);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_ACTIVECAPTION);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_APPWORKSPACE);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_BACKGROUND);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNFACE);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNHIGHLIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNHILIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNSHADOW);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_CAPTIONTEXT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_DESKTOP);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_FRAMEBK);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_GRADIENTACTIVECAPTION);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_GRADIENTINACTIVECAPTION);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVEBORDER);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVECAPTION);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVECAPTIONTEXT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_INFOBK);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_INFOTEXT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_MENU);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUBAR);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUHILIGHT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUTEXT);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_SCROLLBAR);
-    m_deprecatedColourList.insert(wxSYS_COLOUR_WINDOWFRAME);
-#endif
+    if ( m_updatingValues || m_shownItemsStale )
+    {
+        m_shownItemsStale = true;
+    }
+    else if ( MatchesFilter(m_items.back()) )
+    {
+        // the item is the last one, so m_shownItems stays sorted
+        m_shownItems.push_back(index);
+        SetItemCount(static_cast<long>(m_shownItems.size()));
+    }
+
+    return index;
 }
 
-bool SystemColourView::IsDeprecatedSystemColour(wxSystemColour index)
+void SysInfoListView::SetStoredItem(long index, int column, const wxString& label, int imageId)
 {
-#ifndef __WXMSW__
-    wxUnusedVar(index);
-    return false;
-#else
-    return m_deprecatedColourList.find(index) != m_deprecatedColourList.end();
-#endif
-}
+    wxCHECK_RET(index >= 0 && index < GetStoredItemCount(), "invalid item index");
 
+    Item& item = m_items[index];
 
-/*************************************************
+    item.SetText(column, label);
+    if ( imageId != -1 )
+        item.SetImage(column, imageId);
 
-    SystemFontView
+    OnStoredItemChanged(index);
+}
 
-*************************************************/
+void SysInfoListView::SetStoredItemColumnImage(long index, int column, int imageId)
+{
+    wxCHECK_RET(index >= 0 && index < GetStoredItemCount(), "invalid item index");
 
-class SystemFontView : public SystemSettingView
+    m_items[index].SetImage(column, imageId);
+    OnStoredItemChanged(index);
+}
+
+wxString SysInfoListView::GetStoredItemText(long index, int column) const
 {
-public:
-    SystemFontView(wxWindow* parent);
+    wxCHECK_MSG(index >= 0 && index < GetStoredItemCount(), wxString(), "invalid item index");
 
-    bool CanShowDetailedInformation() const override { return GetFirstSelected() != -1; }
+    const Item& item = m_items[index];
 
-protected:
-    void DoUpdateValues() override;
-    void DoShowDetailedInformation(long listItemIndex) const override;
-};
+    if ( column < 0 || static_cast<size_t>(column) >= item.texts.size() )
+        return wxString();
 
-struct FontInfo
+    return item.texts[column];
+}
+
+void SysInfoListView::SetStoredItemData(long index, long data)
 {
-    wxSystemFont index;
-    const char*  name;
-    const char*  description;
-};
+    wxCHECK_RET(index >= 0 && index < GetStoredItemCount(), "invalid item index");
 
-FontInfo const s_fontInfoArray[] =
+    m_items[index].data = data;
+}
+
+long SysInfoListView::GetStoredItemData(long index) const
 {
-    wxSYS_OEM_FIXED_FONT, "wxSYS_OEM_FIXED_FONT", "Original equipment manufacturer dependent fixed-pitch font.",
-    wxSYS_ANSI_FIXED_FONT, "wxSYS_ANSI_FIXED_FONT", "Windows fixed-pitch (monospaced) font.",
-    wxSYS_ANSI_VAR_FONT, "wxSYS_ANSI_VAR_FONT", "Windows variable-pitch (proportional) font.",
-    wxSYS_SYSTEM_FONT, "wxSYS_SYSTEM_FONT", "System font. By default, the system uses the system font to draw menus, dialog box controls, and text.",
-    wxSYS_DEVICE_DEFAULT_FONT, "wxSYS_DEVICE_DEFAULT_FONT", "Device-dependent font.",
-    wxSYS_DEFAULT_GUI_FONT, "wxSYS_DEFAULT_GUI_FONT", "Default font for user interface objects such as menus and dialog boxes.",
-};
+    wxCHECK_MSG(index >= 0 && index < GetStoredItemCount(), 0, "invalid item index");
 
-SystemFontView::SystemFontView(wxWindow* parent)
-    : SystemSettingView(parent)
+    return m_items[index].data;
+}
+
+long SysInfoListView::FindStoredItem(long start, long data) const
 {
-    for ( size_t i = 0; i < WXSIZEOF(s_fontInfoArray); ++i )
-    {
-         const wxString fontName = s_fontInfoArray[i].name;
-         const wxString fontDescription = s_fontInfoArray[i].description;
-         const long itemIndex = AppendItemWithData(fontName, (long)i);
+    const long itemCount = GetStoredItemCount();
 
-         if ( itemIndex != -1 )
-            SetItem(itemIndex, Column_Description, fontDescription);
+    for ( long i = std::max(0L, start); i < itemCount; ++i )
+    {
+        if ( m_items[i].data == data )
+            return i;
     }
 
-    UpdateValues();
+    return -1;
 }
 
-void SystemFontView::DoUpdateValues()
+void SysInfoListView::DeleteAllStoredItems()
 {
-    const int itemCount = GetItemCount();
+    m_items.clear();
+    m_itemsDeleted = true;
+    m_shownItemsStale = true;
+    m_itemToSelect = -1;
 
-    wxLogNull logNo;
+    if ( !m_updatingValues )
+        UpdateShownItems();
+}
 
-    for ( int i = 0; i < itemCount; ++i )
-    {
-         const wxFont font = wxSystemSettings::GetFont(s_fontInfoArray[GetItemData(i)].index);
-         wxString fontValue = _("<Invalid>");
+long SysInfoListView::GetFirstSelectedStoredItem() const
+{
+    // the list control still shows the items before DoUpdateValues() changed them
+    if ( m_shownItemsStale )
+        return m_itemToSelect;
 
-         if ( font.IsOk() )
-              fontValue = font.GetNativeFontInfoUserDesc();
+    const long shownIndex = GetFirstSelected();
 
-         SetItem(i, Column_Value, fontValue);
-    }
+    if ( shownIndex < 0 || static_cast<size_t>(shownIndex) >= m_shownItems.size() )
+        return -1;
+
+    return m_shownItems[shownIndex];
 }
 
-void SystemFontView::DoShowDetailedInformation(long listItemIndex) const
+void SysInfoListView::SelectStoredItem(long index, bool on)
 {
-    const size_t infoArrayIndex = GetItemData(listItemIndex);
-
-    const wxString valueName = s_fontInfoArray[infoArrayIndex].name;
-    const wxFont font = wxSystemSettings::GetFont(s_fontInfoArray[infoArrayIndex].index);
-
-    if ( !font.IsOk() )
+    if ( m_shownItemsStale )
     {
-        wxLogError(_("Invalid font for \"%s\"."), valueName);
+        if ( on )
+            m_itemToSelect = index;
+        else if ( m_itemToSelect == index )
+            m_itemToSelect = -1;
         return;
     }
 
-    wxGetFontFromUser(GetParent(), font, wxString::Format(_("Viewing %s"), valueName));
-}
+    const long shownIndex = GetShownIndex(index);
 
+    if ( shownIndex != -1 )
+        Select(shownIndex, on);
+}
 
-/*************************************************
+void SysInfoListView::FocusStoredItem(long index)
+{
+    // the item to select is also focused in UpdateShownItems()
+    if ( m_shownItemsStale )
+        return;
 
-    SystemMetricView
+    const long shownIndex = GetShownIndex(index);
 
-*************************************************/
+    if ( shownIndex != -1 )
+        Focus(shownIndex);
+}
 
-class SystemMetricView : public SystemSettingView
+wxString SysInfoListView::OnGetItemText(long item, long column) const
 {
-public:
-    SystemMetricView(wxWindow* parent);
-protected:
-    void DoUpdateValues() override;
-};
+    if ( item < 0 || static_cast<size_t>(item) >= m_shownItems.size() )
+        return wxString();
 
+    return GetStoredItemText(m_shownItems[item], column);
+}
 
-struct MetricInfo
+int SysInfoListView::OnGetItemImage(long item) const
 {
-    wxSystemMetric index;
-    const char*    name;
-    const char*    description;
-};
+    return OnGetItemColumnImage(item, 0);
+}
 
-MetricInfo const s_metricInfoArray[] =
+int SysInfoListView::OnGetItemColumnImage(long item, long column) const
 {
-    wxSYS_MOUSE_BUTTONS, "wxSYS_MOUSE_BUTTONS", "Number of buttons on mouse, or zero if no mouse was installed.",
-    wxSYS_BORDER_X, "wxSYS_BORDER_X", "Width of single border.",
-    wxSYS_BORDER_Y, "wxSYS_BORDER_Y", "Height of single border.",
-    wxSYS_CURSOR_X, "wxSYS_CURSOR_X", "Width of cursor.",
-    wxSYS_CURSOR_Y, "wxSYS_CURSOR_Y", "Height of cursor.",
-    wxSYS_DCLICK_X, "wxSYS_DCLICK_X", "Width in pixels of rectangle within which two successive mouse clicks must fall to generate a double-click.",
-    wxSYS_DCLICK_Y, "wxSYS_DCLICK_Y", "Height in pixels of rectangle within which two successive mouse clicks must fall to generate a double-click.",
-    wxSYS_DRAG_X, "wxSYS_DRAG_X", "Width in pixels of a rectangle centered on a drag point to allow for limited movement of the mouse pointer before a drag operation begins.",
-    wxSYS_DRAG_Y, "wxSYS_DRAG_Y", "Height in pixels of a rectangle centered on a drag point to allow for limited movement of the mouse pointer before a drag operation begins.",
-    wxSYS_EDGE_X, "wxSYS_EDGE_X", "Width of a 3D border, in pixels.",
-    wxSYS_EDGE_Y, "wxSYS_EDGE_Y", "Height of a 3D border, in pixels.",
-    wxSYS_HSCROLL_ARROW_X, "wxSYS_HSCROLL_ARROW_X", "Width of arrow bitmap on horizontal scrollbar.",
-    wxSYS_HSCROLL_ARROW_Y, "wxSYS_HSCROLL_ARROW_Y", "Height of arrow bitmap on horizontal scrollbar.",
-    wxSYS_HTHUMB_X, "wxSYS_HTHUMB_X", "Width of horizontal scrollbar thumb.",
-    wxSYS_ICON_X, "wxSYS_ICON_X", "The default width of an icon.",
-    wxSYS_ICON_Y, "wxSYS_ICON_Y", "The default height of an icon.",
-    wxSYS_ICONSPACING_X, "wxSYS_ICONSPACING_X", "Width of a grid cell for items in large icon view, in pixels. Each item fits into a rectangle of this size when arranged.",
-    wxSYS_ICONSPACING_Y, "wxSYS_ICONSPACING_Y", "Height of a grid cell for items in large icon view, in pixels. Each item fits into a rectangle of this size when arranged.",
-    wxSYS_WINDOWMIN_X, "wxSYS_WINDOWMIN_X", "Minimum width of a window.",
-    wxSYS_WINDOWMIN_Y, "wxSYS_WINDOWMIN_Y", "Minimum height of a window.",
-    wxSYS_SCREEN_X, "wxSYS_SCREEN_X", "Width of the screen in pixels.",
-    wxSYS_SCREEN_Y, "wxSYS_SCREEN_Y", "Height of the screen in pixels.",
-    wxSYS_FRAMESIZE_X, "wxSYS_FRAMESIZE_X", "Width of the window frame for a wxTHICK_FRAME window.",
-    wxSYS_FRAMESIZE_Y, "wxSYS_FRAMESIZE_Y", "Height of the window frame for a wxTHICK_FRAME window.",
-    wxSYS_SMALLICON_X, "wxSYS_SMALLICON_X", "Recommended width of a small icon (in window captions, and small icon view).",
-    wxSYS_SMALLICON_Y, "wxSYS_SMALLICON_Y", "Recommended height of a small icon (in window captions, and small icon view).",
-    wxSYS_HSCROLL_Y, "wxSYS_HSCROLL_Y", "Height of horizontal scrollbar in pixels.",
-    wxSYS_VSCROLL_X, "wxSYS_VSCROLL_X", "Width of vertical scrollbar in pixels.",
-    wxSYS_VSCROLL_ARROW_X, "wxSYS_VSCROLL_ARROW_X", "Width of arrow bitmap on a vertical scrollbar.",
-    wxSYS_VSCROLL_ARROW_Y, "wxSYS_VSCROLL_ARROW_Y", "Height of arrow bitmap on a vertical scrollbar.",
-    wxSYS_VTHUMB_Y, "wxSYS_VTHUMB_Y", "Height of vertical scrollbar thumb.",
-    wxSYS_CAPTION_Y, "wxSYS_CAPTION_Y", "Height of normal caption area.",
-    wxSYS_MENU_Y, "wxSYS_MENU_Y", "Height of single-line menu bar.",
-    wxSYS_NETWORK_PRESENT, "wxSYS_NETWORK_PRESENT", "1 if there is a network present, 0 otherwise.",
-    wxSYS_PENWINDOWS_PRESENT, "wxSYS_PENWINDOWS_PRESENT", "1 if PenWindows is installed, 0 otherwise.",
-    wxSYS_SHOW_SOUNDS, "wxSYS_SHOW_SOUNDS", "Non-zero if the user requires an application to present information visually in situations where it would otherwise present the information only in audible form; zero otherwise.",
-    wxSYS_SWAP_BUTTONS, "wxSYS_SWAP_BUTTONS", "Non-zero if the meanings of the left and right mouse buttons are swapped; zero otherwise.",
-    wxSYS_DCLICK_MSEC, "wxSYS_DCLICK_MSEC", "Maximal time, in milliseconds, which may pass between subsequent clicks for a double click to be generated.",
+    if ( item < 0 || static_cast<size_t>(item) >= m_shownItems.size() )
+        return -1;
 
-// there was a bug with these three metrics on wxMSW
-// until commit e5d850d (commited on Apr 18, 2019)
-#if wxCHECK_VERSION(3, 1, 1) && ( !defined(__WXMSW__) || wxCHECK_VERSION(3, 1, 3)  )
-    wxSYS_CARET_ON_MSEC, "wxSYS_CARET_ON_MSEC", "Time, in milliseconds, for how long a blinking caret should stay visible during a single blink cycle before it disappears.",
-    wxSYS_CARET_OFF_MSEC, "wxSYS_CARET_OFF_MSEC", "Time, in milliseconds, for how long a blinking caret should stay invisible during a single blink cycle before it reappears. If this value is zero, carets should be visible all the time instead of blinking. If the value is negative, the platform does not support the user setting. Implemented only on GTK+ and MacOS X.",
-    wxSYS_CARET_TIMEOUT_MSEC, "wxSYS_CARET_TIMEOUT_MSEC", "Time, in milliseconds, for how long a caret should blink after a user interaction. After this timeout has expired, the caret should stay continuously visible until the user interacts with the caret again (for example by entering, deleting or cutting text). If this value is negative, carets should blink forever; if it is zero, carets should not blink at all.",
-#endif // #if wxCHECK_VERSION(3, 1, 1) && ( !defined(__WXMSW__) || wxCHECK_VERSION(3, 1, 3)  )
-};
+    const std::vector<int>& images = m_items[m_shownItems[item]].images;
 
-SystemMetricView::SystemMetricView(wxWindow* parent)
-    : SystemSettingView(parent)
+    if ( column < 0 || static_cast<size_t>(column) >= images.size() )
+        return -1;
+
+    return images[column];
+}
+
+void SysInfoListView::Item::SetText(int column, const wxString& text)
 {
-    for ( size_t i = 0; i < WXSIZEOF(s_metricInfoArray); ++i )
-    {
-         const wxString metricName = s_metricInfoArray[i].name;
-         const wxString metricDescription = s_metricInfoArray[i].description;
-         const long itemIndex = AppendItemWithData(metricName, (long)i);
+    if ( column < 0 )
+        return;
 
-         if ( itemIndex != -1 )
-            SetItem(itemIndex, Column_Description, metricDescription);
-    }
+    if ( static_cast<size_t>(column) >= texts.size() )
+        texts.resize(column + 1);
 
-    m_columnWidths[Column_Value] = wxLIST_AUTOSIZE_USEHEADER;
+    if ( texts[column] == text )
+        return;
 
-    UpdateValues();
+    texts[column] = text;
+    searchTextValid = false;
+    textWidths.clear();
 }
 
-void SystemMetricView::DoUpdateValues()
+void SysInfoListView::Item::SetImage(int column, int imageId)
 {
-    const int itemCount = GetItemCount();
+    if ( column < 0 )
+        return;
 
-    for ( int i = 0; i < itemCount; ++i )
-    {
-         const int metricValue  = wxSystemSettings::GetMetric(s_metricInfoArray[GetItemData(i)].index, wxGetTopLevelParent(this));
+    if ( static_cast<size_t>(column) >= images.size() )
+        images.resize(column + 1, -1);
 
-         SetItem(i, Column_Value, wxString::Format("%d", metricValue));
-    }
+    images[column] = imageId;
 }
 
+const wxString& SysInfoListView::GetSearchText(const Item& item) const
+{
+    if ( !item.searchTextValid )
+    {
+        item.searchText.clear();
+        for ( size_t i = 0; i < item.texts.size(); ++i )
+        {
+            if ( i > 0 )
+                item.searchText += '\t';
+            item.searchText += item.texts[i];
+        }
+        item.searchText.MakeLower();
+        item.searchTextValid = true;
+    }
 
-/*************************************************
+    return item.searchText;
+}
 
-    DisplaysView
+bool SysInfoListView::MatchesFilter(const Item& item) const
+{
+    return m_filter.empty() || GetSearchText(item).find(m_filter) != wxString::npos;
+}
 
-*************************************************/
+long SysInfoListView::GetShownIndex(long index) const
+{
+    const auto it = std::lower_bound(m_shownItems.begin(), m_shownItems.end(), index);
 
-#ifdef __WXMSW__
+    if ( it == m_shownItems.end() || *it != index )
+        return -1;
 
-// The code for obtaining friendly monitor names is adapted from
-// https://gist.github.com/pavel-a/dd3a4320176e69a0f6c4b4871e69e56b
+    return static_cast<long>(it - m_shownItems.begin());
+}
 
-BOOL CALLBACK MonitorInfoEnumProc(HMONITOR hMonitor, HDC, LPRECT, LPARAM dwData)
+void SysInfoListView::OnStoredItemChanged(long index)
 {
-    WinStruct<MONITORINFOEXW> info;
-    UINT32 pathCount, modeCount;
-    std::vector<DISPLAYCONFIG_PATH_INFO> paths;
-    std::vector<DISPLAYCONFIG_MODE_INFO> modes;
-
-    if ( !::GetMonitorInfoW(hMonitor, &info) )
-        return FALSE;
+    if ( m_shownItemsStale )
+        return;
 
-    if ( ::GetDisplayConfigBufferSizes(QDC_ONLY_ACTIVE_PATHS, &pathCount, &modeCount) != ERROR_SUCCESS )
-        return FALSE;
+    const long shownIndex = GetShownIndex(index);
 
-    if ( !pathCount || !modeCount )
-        return FALSE;
+    // the item may now (not) match the filter
+    if ( (shownIndex != -1) != MatchesFilter(m_items[index]) )
+    {
+        m_shownItemsStale = true;
+        if ( !m_updatingValues )
+            UpdateShownItems();
+        return;
+    }
 
-    paths.resize(pathCount);
-    modes.resize(modeCount);
+    // the whole list control is refreshed after DoUpdateValues()
+    if ( shownIndex != -1 && !m_updatingValues )
+        RefreshItem(shownIndex);
+}
 
-    if ( ::QueryDisplayConfig(QDC_ONLY_ACTIVE_PATHS,
-            &pathCount, paths.data(), &modeCount, modes.data(), nullptr) != ERROR_SUCCESS )
-        return FALSE;
+void SysInfoListView::UpdateShownItems()
+{
+    const long previousSelection = m_itemsDeleted ? -1 : GetFirstSelected();
+    // keep the selected item selected if it still matches the filter
+    long itemToSelect = m_itemToSelect;
 
-    for ( const auto& p : paths )
+    if ( itemToSelect == -1 && previousSelection >= 0
+         && static_cast<size_t>(previousSelection) < m_shownItems.size() )
     {
-        DISPLAYCONFIG_SOURCE_DEVICE_NAME sourceName;
+        itemToSelect = m_shownItems[previousSelection];
+    }
 
-        sourceName.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME;
-        sourceName.header.size = sizeof(sourceName);
-        sourceName.header.adapterId = p.sourceInfo.adapterId;
-        sourceName.header.id = p.sourceInfo.id;
-        if ( ::DisplayConfigGetDeviceInfo(&sourceName.header) != ERROR_SUCCESS )
-            return FALSE;
+    m_shownItems.clear();
+    for ( size_t i = 0; i < m_items.size(); ++i )
+    {
+        if ( MatchesFilter(m_items[i]) )
+            m_shownItems.push_back(static_cast<long>(i));
+    }
 
-        if ( ::wcscmp(info.szDevice, sourceName.viewGdiDeviceName) != 0 )
-            continue;
+    const long shownIndex = GetShownIndex(itemToSelect);
+    // the selection is changed only when the selected item moved or was hidden
+    const bool selectionMoved = shownIndex != previousSelection;
 
-        DISPLAYCONFIG_TARGET_DEVICE_NAME name;
+    // like with the non-virtual list control, deleting the items removes the selection
+    if ( m_itemsDeleted )
+        DeleteAllItems();
+    else if ( selectionMoved && previousSelection != -1 )
+        Select(previousSelection, false);
 
-        name.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_TARGET_NAME;
-        name.header.size = sizeof(name);
-        name.header.adapterId = p.sourceInfo.adapterId;
-        name.header.id = p.targetInfo.id;
-        if ( ::DisplayConfigGetDeviceInfo(&name.header) != ERROR_SUCCESS )
-            return FALSE;
+    m_shownItemsStale = false;
+    m_itemsDeleted = false;
+    m_itemToSelect = -1;
 
-        wxArrayString* friendlyNames = reinterpret_cast<wxArrayString*>(dwData);
+    SetItemCount(static_cast<long>(m_shownItems.size()));
 
-        friendlyNames->push_back(wxString(name.monitorFriendlyDeviceName));
-        return TRUE;
+    if ( selectionMoved && shownIndex != -1 )
+    {
+        Select(shownIndex);
+        Focus(shownIndex);
     }
 
-    return FALSE;
+    Refresh();
 }
 
-#endif // #ifdef __WXMSW__
+void SysInfoListView::SampleValues(wxLongLong_t time, int interval)
+{
+    if ( time + SampleTimeTolerance < m_nextSampleTime )
+        return;
 
+    UpdateValues(Volatility_Live);
+    m_nextSampleTime = time + interval;
+}
 
-class DisplaysView : public SysInfoListView
+void SysInfoListView::ShowDetailedInformation() const
 {
-public:
-    DisplaysView(wxWindow* parent);
+    DoShowDetailedInformation(GetFirstSelectedStoredItem());
+}
 
-    wxArrayString GetValues(const wxString& separator) const override;
+long SysInfoListView::AppendItemWithData(const wxString& label, long data)
+{
+    const long itemIndex = AddStoredItem(label);
 
-protected:
-    void DoUpdateValues() override;
-private:
-    enum
-    {
-        Param_Name = 0,
-        Param_FriendlyName,
-        Param_IsPrimary,
-        Param_Resolution,
-        Param_BPP,
-        Param_Frequency,
-        Param_GeometryCoords,
-        Param_GeometrySize,
-        Param_ClientAreaCoords,
-        Param_ClientAreaSize,
-        Param_PPI,
-        Param_HasThisWindow
-    };
-};
+    if ( itemIndex == -1 )
+        wxLogError(_("Could not insert item with label '%s'"), label);
+    else
+        SetStoredItemData(itemIndex, data);
 
-DisplaysView::DisplaysView(wxWindow* parent)
-    : SysInfoListView(parent)
+    return itemIndex;
+}
+
+long SysInfoListView::AppendItemWithValue(const wxString& label, const wxString& value)
 {
-    AppendColumn(_("Parameter"));
+    const long itemIndex = AddStoredItem(label);
 
-    AppendItemWithData(_("Name"), Param_Name);
-#ifdef __WXMSW__
-    AppendItemWithData(_("Friendly Name"), Param_FriendlyName);
-#endif
-    AppendItemWithData(_("Is Primary"), Param_IsPrimary);
-    AppendItemWithData(_("Resolution"), Param_Resolution);
-    AppendItemWithData(_("Bits Per Pixel"), Param_BPP);
-    AppendItemWithData(_("Refresh Frequency (Hz)"), Param_Frequency);
-    AppendItemWithData(_("Geometry Coordinates (left, top; right, bottom)"), Param_GeometryCoords);
-    AppendItemWithData(_("Geometry Size"), Param_GeometrySize);
-    AppendItemWithData(_("Client Area Coordinates (left, top; right, bottom)"), Param_ClientAreaCoords);
-    AppendItemWithData(_("Client Area Size"), Param_ClientAreaSize);
-    AppendItemWithData(_("Pixels Per Inch"), Param_PPI);
-    AppendItemWithData(_("Has This Window"), Param_HasThisWindow);
+    if ( itemIndex == -1 )
+        wxLogError(_("Could not insert item with label '%s'"), label);
+    else
+        SetStoredItem(itemIndex, 1, value);
 
-    UpdateValues();
+    return itemIndex;
 }
 
-wxArrayString DisplaysView::GetValues(const wxString& separator) const
+void SysInfoListView::SetStoredItems(const std::vector<std::pair<long, wxArrayString>>& items)
 {
-    const int itemCount = GetItemCount();
-    const int columnCount = GetColumnCount();
+    const size_t itemCount = items.size();
+    bool sameItems = static_cast<size_t>(GetStoredItemCount()) == itemCount;
 
-    wxArrayString values;
-    wxString s;
+    for ( size_t i = 0; sameItems && i < itemCount; ++i )
+    {
+        sameItems = GetStoredItemData(i) == items[i].first
+                    && !items[i].second.empty() && GetStoredItemText(i) == items[i].second[0];
+    }
+
+    if ( !sameItems )
+    {
+        const long selectedItem = GetFirstSelectedStoredItem();
+        const long selectedData = selectedItem != -1 ? GetStoredItemData(selectedItem) : 0;
+        const wxString selectedLabel = selectedItem != -1 ? GetStoredItemText(selectedItem) : wxString();
+
+        DeleteAllStoredItems();
+        for ( const auto& item : items )
+        {
+            const long itemIndex = AppendItemWithData(item.second.empty() ? wxString() : item.second[0], item.first);
+
+            if ( itemIndex != -1 && selectedItem != -1
+                 && item.first == selectedData && GetStoredItemText(itemIndex) == selectedLabel )
+            {
+                SelectStoredItem(itemIndex);
+            }
+        }
+    }
+
+    for ( size_t i = 0; i < itemCount; ++i )
+    {
+        const wxArrayString& texts = items[i].second;
+
+        for ( size_t column = 1; column < texts.size(); ++column )
+        {
+            if ( GetStoredItemText(i, column) != texts[column] )
+                SetStoredItem(i, column, texts[column]);
+        }
+    }
+}
+
+void SysInfoListView::SetItemsWithValues(const std::vector<std::pair<wxString, wxString>>& items)
+{
+    std::vector<std::pair<long, wxArrayString>> itemsWithData;
+
+    itemsWithData.reserve(items.size());
+    for ( const auto& item : items )
+    {
+        wxArrayString texts;
+
+        texts.reserve(2);
+        texts.push_back(item.first);
+        texts.push_back(item.second);
+        itemsWithData.emplace_back(0, texts);
+    }
+
+    SetStoredItems(itemsWithData);
+}
+
+wxArrayString SysInfoListView::GetNameAndValueValues(int nameColumnIndex, int valueColumnIndex, const wxString& separator) const
+{
+    const int itemCount = GetStoredItemCount();
+
+    wxArrayString values;
 
     values.reserve(itemCount + 1);
 
     // column headings
-    s = _("Parameter");
+    values.push_back(wxString::Format(wxS("%s%s%s"), _("Name"), separator, _("Value")));
 
-    for ( int columnIndex = 1; columnIndex < columnCount; ++columnIndex )
+    // dump values
+    for ( int i = 0; i < itemCount; ++i )
+    {
+        values.push_back(wxString::Format(wxS("%s%s%s"),
+            GetStoredItemText(i, nameColumnIndex),
+            separator,
+            GetStoredItemText(i, valueColumnIndex)));
+    }
+
+    return values;
+}
+
+wxArrayString SysInfoListView::GetAllColumnsValues(const wxString& separator) const
+{
+    const int itemCount = GetStoredItemCount();
+    const int columnCount = GetColumnCount();
+
+    wxArrayString values;
+    wxString s;
+
+    values.reserve(itemCount + 1);
+
+    // column headings
+    for ( int columnIndex = 0; columnIndex < columnCount; ++columnIndex )
     {
         wxListItem listItem;
 
         listItem.SetMask(wxLIST_MASK_TEXT);
         GetColumn(columnIndex, listItem);
-        s += separator + listItem.GetText();
+        if ( columnIndex > 0 )
+            s += separator;
+        s += listItem.GetText();
     }
     values.push_back(s);
 
     // dump values
     for ( int itemIndex = 0; itemIndex < itemCount; ++itemIndex )
     {
-        s = GetItemText(itemIndex, 0);
+        s = GetStoredItemText(itemIndex, 0);
         for ( int columnIndex = 1; columnIndex < columnCount; ++columnIndex )
         {
-            s += separator + GetItemText(itemIndex, columnIndex);
+            s += separator + GetStoredItemText(itemIndex, columnIndex);
         }
         values.push_back(s);
     }
@@ -841,1223 +1365,881 @@ wxArrayString DisplaysView::GetValues(const wxString& separator) const
     return values;
 }
 
-void DisplaysView::DoUpdateValues()
+// wxLIST_AUTOSIZE does not measure the items of a virtual list control,
+// or measures only the visible ones, so the widths of the shown items' texts
+// are measured here; the widths are cached in the items
+void SysInfoListView::AutoSizeColumns()
 {
-    while ( GetColumnCount() > 1 )
-        DeleteColumn(1);
+    const int columnCount = GetColumnCount();
+    const int charWidth = GetCharWidth();
+    const int margin = 2 * charWidth;
+    const wxImageList* imageList = GetImageList(wxIMAGE_LIST_SMALL);
+    int imageWidth = 0, imageHeight = 0;
+    std::vector<int> widths(columnCount, 0);
 
-    const unsigned int displayCount = wxDisplay::GetCount();
-    const int displayForThisWindow = wxDisplay::GetFromWindow(wxGetTopLevelParent(this));
-    const int itemCount = GetItemCount();
+    if ( imageList && imageList->GetImageCount() > 0 )
+        imageList->GetSize(0, imageWidth, imageHeight);
 
-#ifdef __WXMSW__
-    wxArrayString friendlyNames;
+    if ( charWidth != m_measuredCharWidth )
+    {
+        for ( const auto& item : m_items )
+            item.textWidths.clear();
+        m_measuredCharWidth = charWidth;
+    }
 
-    if ( !::EnumDisplayMonitors(nullptr, nullptr, MonitorInfoEnumProc, (LPARAM)&friendlyNames) )
-        friendlyNames.clear();
-#endif // #ifdef __WXMSW__
+    for ( int i = 0; i < columnCount; ++i )
+    {
+        wxListItem listItem;
 
-    for ( size_t displayIndex = 0; displayIndex < displayCount; ++displayIndex )
+        listItem.SetMask(wxLIST_MASK_TEXT);
+        GetColumn(i, listItem);
+        widths[i] = GetTextExtent(listItem.GetText()).GetWidth();
+    }
+
+    for ( const long index : m_shownItems )
     {
-        const wxDisplay display(displayIndex);
-        const wxVideoMode videoMode = display.GetCurrentMode();
-        const wxRect geometryCoords = display.GetGeometry();
-        const wxRect clientAreaCoords = display.GetClientArea();
-        const int columnIndex = displayIndex + 1;
+        const Item& item = m_items[index];
+        const int itemColumnCount = std::min(columnCount,
+                                             static_cast<int>(std::max(item.texts.size(), item.images.size())));
 
-        AppendColumn(wxString::Format("wxDisplay(%zu)", displayIndex));
+        if ( item.textWidths.empty() )
+        {
+            item.textWidths.reserve(item.texts.size());
+            for ( const auto& text : item.texts )
+                item.textWidths.push_back(text.empty() ? 0 : GetTextExtent(text).GetWidth());
+        }
 
-        for ( int itemIndex = 0; itemIndex < itemCount; ++itemIndex )
+        for ( int i = 0; i < itemColumnCount; ++i )
         {
-            const int param = GetItemData(itemIndex);
-            wxString value;
+            int width = static_cast<size_t>(i) < item.textWidths.size() ? item.textWidths[i] : 0;
 
-            switch ( param )
-            {
-                case Param_Name:
-                    value = display.GetName();
-                    break;
-#ifdef __WXMSW__
-                case Param_FriendlyName:
-                    if ( friendlyNames.size() == displayCount )
-                        value = friendlyNames[displayIndex];
-                    else
-                        value = _("N/A");
-                    break;
-#endif // #ifdef __WXMSW__
-                case Param_IsPrimary:
-                    value =  display.IsPrimary() ? _("Yes") : _("No");
-                    break;
-                case Param_Resolution:
-                    value = wxSizeTowxString(wxSize(videoMode.GetWidth(), videoMode.GetHeight()));
-                    break;
-                case Param_BPP:
-                    value.Printf("%d", videoMode.GetDepth());
-                    break;
-                case Param_Frequency:
-                    value.Printf("%d", videoMode.refresh);
-                    break;
-                case Param_GeometryCoords:
-                    value = wxRectTowxString(geometryCoords);
-                    break;
-                case Param_GeometrySize:
-                    value = wxSizeTowxString(geometryCoords.GetSize());
-                    break;
-                case Param_ClientAreaCoords:
-                    value = wxRectTowxString(clientAreaCoords);
-                    break;
-                case Param_ClientAreaSize:
-                    value = wxSizeTowxString(clientAreaCoords.GetSize());
-                    break;
-                case Param_PPI:
-                    value = wxSizeTowxString(display.GetPPI());
-                    break;
-                case Param_HasThisWindow:
-                    value = displayForThisWindow == displayIndex ? _("Yes") : _("No");
-                    break;
-                default:
-                    wxFAIL;
-            }
+            if ( static_cast<size_t>(i) < item.images.size() && item.images[i] != -1 )
+                width += imageWidth + margin / 2;
 
-            SetItem(itemIndex, columnIndex, value);
+            widths[i] = std::max(widths[i], width);
         }
     }
+
+    for ( int i = 0; i < columnCount; ++i )
+    {
+        const auto it = m_columnWidths.find(i);
+
+        if ( it != m_columnWidths.end() )
+            SetColumnWidth(i, it->second);
+        else
+            SetColumnWidth(i, widths[i] + margin);
+    }
 }
 
+void SysInfoListView::OnColumnEndDrag(wxListEvent& event)
+{
+    event.Skip();
+    m_columnWidths[event.GetColumn()] = GetColumnWidth(event.GetColumn());
+}
+
+void SysInfoListView::OnItemActivated(wxListEvent& event)
+{
+    const long shownIndex = event.GetIndex();
+
+    if ( shownIndex >= 0 && static_cast<size_t>(shownIndex) < m_shownItems.size() )
+        DoShowDetailedInformation(m_shownItems[shownIndex]);
+}
+
+
 
 /*************************************************
 
-    SystemOptionsView
+    SampledSysInfoListView
 
 *************************************************/
 
-class SystemOptionsView : public SysInfoListView
+// A view whose values are periodically refreshed with its own interval,
+// independently of refreshing all the views on system setting changes.
+// The samples are scheduled by wxSystemInformationFrame,
+// the values are not sampled while the view is not shown on screen.
+class SampledSysInfoListView : public SysInfoListView
 {
 public:
-    SystemOptionsView(wxWindow* parent);
-
-    wxArrayString GetValues(const wxString& separator) const override
-    {
-        return GetNameAndValueValues(Column_Name, Column_Value, separator);
-    }
-
-protected:
-    void DoUpdateValues() override;
-private:
-    enum
-    {
-        Column_Name = 0,
-        Column_Value,
-    };
+    SampledSysInfoListView(wxWindow* parent, int sampleInterval);
 
-    enum
-    {
-        Param_ExitOnAssert = 0,
+    // in milliseconds, 0 stops the sampling
+    void SetSampleInterval(int sampleInterval);
+    int GetSampleInterval(bool WXUNUSED(liveRefresh)) const override { return m_sampleInterval; }
 
-        // MSW options
+    int GetVolatilities() const override { return Volatility_Live; }
 
-        Param_MSWDarkMode,
-        Param_MSWFontNoProofQuality,
-        Param_MSWNotebookThemedBackground,
-        Param_MSWRemap,
-        Param_MSWStaticBoxOptimizedPaint,
-        Param_MSWWindowNoClipChildren,
-        Param_MSWWindowNoComposited,
-        Param_NoMaskBit,
+protected:
+    // time elapsed since the view was created, in milliseconds
+    long GetSampleTime() const { return m_sampleStopWatch.Time(); }
 
-        // GTK options
-        Param_GTKDesktop,
-        Param_GTKTLWCanSetTransparent,
-        Param_GTKWindowForceBackgroundColour,
+private:
+    int         m_sampleInterval{0};
+    wxStopWatch m_sampleStopWatch;
 
-        // MAC options
-        Param_MacListCtrlAwaysUseGeneric,
-        Param_MacTextControlUseSpellChecker,
-        Param_MacWindowDefaultVariant,
-        Param_MacWindowPlainTransition,
-        Param_OSXFileDialogAlwaysShowTypes,
-    };
+    void OnContextMenu(wxContextMenuEvent& event);
 };
 
-SystemOptionsView::SystemOptionsView(wxWindow* parent)
+SampledSysInfoListView::SampledSysInfoListView(wxWindow* parent, int sampleInterval)
     : SysInfoListView(parent)
 {
-    InsertColumn(Column_Name, _("Name"));
-    InsertColumn(Column_Value, _("Value"));
-
-    AppendItemWithData(wxS("exit-on-assert"), Param_ExitOnAssert);
-
-#ifdef __WXMSW__
-    AppendItemWithData(wxS("msw.dark-mode"), Param_MSWDarkMode);
-    AppendItemWithData(wxS("msw.font.no-proof-quality"), Param_MSWFontNoProofQuality);
-    AppendItemWithData(wxS("msw.notebook.themed-background"), Param_MSWNotebookThemedBackground);
-    AppendItemWithData(wxS("msw.remap"), Param_MSWRemap);
-    AppendItemWithData(wxS("msw.staticbox.optimized-paint"), Param_MSWStaticBoxOptimizedPaint);
-    AppendItemWithData(wxS("msw.window.no-clip-children"), Param_MSWWindowNoClipChildren);
-    AppendItemWithData(wxS("msw.window.no-composited"), Param_MSWWindowNoComposited);
-    AppendItemWithData(wxS("no-maskblt"), Param_NoMaskBit);
-#endif // #ifdef __WXMSW__
-
-#ifdef __WXGTK__
-    AppendItemWithData(wxS("gtk.desktop"), Param_GTKDesktop);
-    AppendItemWithData(wxS("gtk.tlw.can-set-transparent"), Param_GTKTLWCanSetTransparent);
-    AppendItemWithData(wxS("gtk.window.force-background-colour"), Param_GTKWindowForceBackgroundColour);
-#endif // #ifdef __WXGTK__
-
-#ifdef __WXMAC__
-    AppendItemWithData(wxS("mac.listctrl.always_use_generic"), Param_MacListCtrlAwaysUseGeneric);
-    AppendItemWithData(wxS("mac.textcontrol-use-spell-checker"), Param_MacTextControlUseSpellChecker);
-    AppendItemWithData(wxS("window-default-variant"), Param_MacWindowDefaultVariant);
-    AppendItemWithData(wxS("mac.window-plain-transition"), Param_MacWindowPlainTransition);
-    AppendItemWithData(wxS("osx.openfiledialog.always-show-types"), Param_OSXFileDialogAlwaysShowTypes);
-#endif // #ifdef __WXMAC__
+    Bind(wxEVT_CONTEXT_MENU, &SampledSysInfoListView::OnContextMenu, this);
 
-    UpdateValues();
+    SetSampleInterval(sampleInterval);
 }
 
-wxString SysOptToString(const wxString& name)
+void SampledSysInfoListView::SetSampleInterval(int sampleInterval)
 {
-    if ( wxSystemOptions::HasOption(name) )
-        return wxSystemOptions::GetOption(name);
+    wxCHECK_RET(sampleInterval >= 0, "invalid sample interval");
 
-    return _("<Not Set>");
+    m_sampleInterval = sampleInterval;
 }
 
-void SystemOptionsView::DoUpdateValues()
+// allows the user to change the sample interval
+void SampledSysInfoListView::OnContextMenu(wxContextMenuEvent& event)
 {
-    const long itemCount = GetItemCount();
+    static const int sampleIntervals[] = { 250, 500, 1000, 2000, 5000, 10000, 0 };
 
-    for ( int i = 0; i < itemCount; ++i )
+    wxMenu menu;
+    wxPoint position = event.GetPosition();
+
+    for ( size_t i = 0; i < WXSIZEOF(sampleIntervals); ++i )
     {
-        const long param = GetItemData(i);
-        wxString value;
+        const int interval = sampleIntervals[i];
+        const int id = wxID_HIGHEST + 1 + static_cast<int>(i);
 
-        switch ( param )
-        {
-            case Param_ExitOnAssert: value = SysOptToString(wxS("exit-on-assert")); break;
+        if ( interval > 0 )
+            menu.AppendRadioItem(id, wxString::Format(_("Sample Every %d ms"), interval));
+        else
+            menu.AppendRadioItem(id, _("Pause Sampling"));
 
-            case Param_MSWDarkMode:                 value = SysOptToString(wxS("msw.dark-mode")); break;
-            case Param_MSWFontNoProofQuality:       value = SysOptToString(wxS("msw.font.no-proof-quality")); break;
-            case Param_MSWNotebookThemedBackground: value = SysOptToString(wxS("msw.notebook.themed-background")); break;
-            case Param_MSWRemap:                    value = SysOptToString(wxS("msw.remap")); break;
-            case Param_MSWStaticBoxOptimizedPaint:  value = SysOptToString(wxS("msw.staticbox.optimized-paint")); break;
-            case Param_MSWWindowNoClipChildren:     value = SysOptToString(wxS("msw.window.no-clip-children")); break;
-            case Param_MSWWindowNoComposited:       value = SysOptToString(wxS("msw.window.no-composited")); break;
-            case Param_NoMaskBit:                   value = SysOptToString(wxS("no-maskblt")); break;
+        menu.Check(id, interval == m_sampleInterval);
+    }
 
-            case Param_GTKDesktop:                     value = SysOptToString(wxS("gtk.desktop")); break;
-            case Param_GTKTLWCanSetTransparent:        value = SysOptToString(wxS("gtk.tlw.can-set-transparent")); break;
-            case Param_GTKWindowForceBackgroundColour: value = SysOptToString(wxS("gtk.window.force-background-colour")); break;
+    // the position is wxDefaultPosition when the menu was invoked from the keyboard
+    if ( position != wxDefaultPosition )
+        position = ScreenToClient(position);
 
-            case Param_MacListCtrlAwaysUseGeneric:    value = SysOptToString(wxS("mac.listctrl.always_use_generic")); break;
-            case Param_MacTextControlUseSpellChecker: value = SysOptToString(wxS("mac.textcontrol-use-spell-checker")); break;
-            case Param_MacWindowDefaultVariant:       value = SysOptToString(wxS("window-default-variant")); break;
-            case Param_MacWindowPlainTransition:      value = SysOptToString(wxS("mac.window-plain-transition")); break;
-            case Param_OSXFileDialogAlwaysShowTypes:  value = SysOptToString(wxS("osx.openfiledialog.always-show-types")); break;
-        }
+    const int id = GetPopupMenuSelectionFromUser(menu, position);
 
-        SetItem(i, Column_Value, value);
-    }
+    if ( id > wxID_HIGHEST && id <= wxID_HIGHEST + static_cast<int>(WXSIZEOF(sampleIntervals)) )
+        SetSampleInterval(sampleIntervals[id - wxID_HIGHEST - 1]);
 }
 
 
 /*************************************************
 
-    StandardPathsView
+    ListViewSparklines
 
 *************************************************/
 
-class StandardPathsView : public SysInfoListView
+// Shows the recent values of numeric rows as sparkline images in a column
+// of a report list view. The values of each row are kept in a fixed-size
+// ring buffer and the image of a row is redrawn only when a value was added
+// to it since the last update, the other rows are not touched.
+// The values must not be negative, the lines are scaled between 0 and the
+// largest value, so that the rows with small changes of large values,
+// e.g., memory sizes, do not look as if they changed a lot.
+class ListViewSparklines
 {
 public:
-    StandardPathsView(wxWindow* parent);
+    ListViewSparklines(SysInfoListView* listView, int column, size_t maxValueCount = 60);
+
+    // the row is identified by its item data
+    void AddValue(long itemData, double value);
+
+    // redraws the sparklines with new values, to be called after the values were added
+    void Update();
+
+    const wxSize& GetImageSize() const { return m_imageSize; }
 
-    wxArrayString GetValues(const wxString& separator) const override
-    {
-        return GetNameAndValueValues(Column_Name, Column_Value, separator);
-    }
-protected:
-    void DoUpdateValues() override;
 private:
-    enum
+    struct Sparkline
     {
-        Column_Name = 0,
-        Column_Value,
+        std::vector<double> values;
+        size_t              nextValueIndex{0};
+        int                 imageIndex{-1};
+        bool                dirty{false};
     };
 
-    enum
-    {
-        Param_ExecutablePath = 0,
-        Param_AppDocumentsDir,
-        Param_ConfigDir,
-        Param_DataDir,
-        Param_DocumentsDir,
-        Param_LocalDataDir,
-        Param_PluginsDir,
-        Param_ResourcesDir,
-        Param_TempDir,
-        Param_UserConfigDir,
-        Param_UserDataDir,
-        Param_UserLocalDataDir,
+    SysInfoListView*          m_listView{nullptr};
+    int                       m_column{0};
+    size_t                    m_maxValueCount{0};
+    wxImageList*              m_imageList{nullptr};
+    wxSize                    m_imageSize;
+    std::map<long, Sparkline> m_sparklines; // item data, sparkline
 
-        // the group below is available only for wxWidgets 3.1+
-        Param_UserDir_Cache,
-        Param_UserDir_Documents,
-        Param_UserDir_Desktop,
-        Param_UserDir_Downloads,
-        Param_UserDir_Music,
-        Param_UserDir_Pictures,
-        Param_UserDir_Videos,
+    wxBitmap CreateSparklineBitmap(const Sparkline& sparkline) const;
+};
 
-        // the group below is available only for wxMSW
-        Param_CSIDL_DESKTOP,
-        Param_CSIDL_INTERNET,
-        Param_CSIDL_PROGRAMS,
-        Param_CSIDL_CONTROLS,
-        Param_CSIDL_PRINTERS,
-        Param_CSIDL_FAVORITES,
-        Param_CSIDL_STARTUP,
-        Param_CSIDL_RECENT,
-        Param_CSIDL_SENDTO,
-        Param_CSIDL_BITBUCKET,
-        Param_CSIDL_STARTMENU,
-        Param_CSIDL_MYDOCUMENTS,
-        Param_CSIDL_MYMUSIC,
-        Param_CSIDL_MYVIDEO,
-        Param_CSIDL_DESKTOPDIRECTORY,
-        Param_CSIDL_DRIVES,
-        Param_CSIDL_NETWORK,
-        Param_CSIDL_NETHOOD,
-        Param_CSIDL_FONTS,
-        Param_CSIDL_TEMPLATES,
-        Param_CSIDL_COMMON_STARTMENU,
-        Param_CSIDL_COMMON_PROGRAMS,
-        Param_CSIDL_COMMON_STARTUP,
-        Param_CSIDL_COMMON_DESKTOPDIRECTORY,
-        Param_CSIDL_APPDATA,
-        Param_CSIDL_PRINTHOOD,
-        Param_CSIDL_LOCAL_APPDATA,
-        Param_CSIDL_ALTSTARTUP,
-        Param_CSIDL_COMMON_ALTSTARTUP,
-        Param_CSIDL_COMMON_FAVORITES,
-        Param_CSIDL_INTERNET_CACHE,
-        Param_CSIDL_COOKIES,
-        Param_CSIDL_HISTORY,
-        Param_CSIDL_COMMON_APPDATA,
-        Param_CSIDL_WINDOWS,
-        Param_CSIDL_SYSTEM,
-        Param_CSIDL_PROGRAM_FILES,
-        Param_CSIDL_MYPICTURES,
-        Param_CSIDL_PROFILE,
-        Param_CSIDL_SYSTEMX86,
-        Param_CSIDL_PROGRAM_FILESX86,
-        Param_CSIDL_PROGRAM_FILES_COMMON,
-        Param_CSIDL_PROGRAM_FILES_COMMONX86,
-        Param_CSIDL_COMMON_TEMPLATES,
-        Param_CSIDL_COMMON_DOCUMENTS,
-        Param_CSIDL_COMMON_ADMINTOOLS,
-        Param_CSIDL_ADMINTOOLS,
-        Param_CSIDL_CONNECTIONS,
-        Param_CSIDL_COMMON_MUSIC,
-        Param_CSIDL_COMMON_PICTURES,
-        Param_CSIDL_COMMON_VIDEO,
-        Param_CSIDL_RESOURCES,
-        Param_CSIDL_RESOURCES_LOCALIZED,
-        Param_CSIDL_COMMON_OEM_LINKS,
-        Param_CSIDL_COMPUTERSNEARME,
+ListViewSparklines::ListViewSparklines(SysInfoListView* listView, int column, size_t maxValueCount)
+    : m_listView(listView), m_column(column), m_maxValueCount(maxValueCount)
+{
+    wxASSERT(m_listView);
+    wxASSERT(m_maxValueCount > 1);
 
-        // GTK only
-        Param_InstallPrefix,
-    };
-};
+    // a pixel for each value at the standard DPI
+    m_imageSize.Set(m_maxValueCount, 16);
+#if wxCHECK_VERSION(3, 1, 0)
+    m_imageSize = m_listView->FromDIP(m_imageSize);
+#endif
+}
 
-StandardPathsView::StandardPathsView(wxWindow* parent)
-    : SysInfoListView(parent)
+void ListViewSparklines::AddValue(long itemData, double value)
 {
-    InsertColumn(Column_Name, _("Name"));
-    InsertColumn(Column_Value, _("Value"));
+    Sparkline& sparkline = m_sparklines[itemData];
 
-    AppendItemWithData("ExecutablePath", Param_ExecutablePath);
-    AppendItemWithData("AppDocumentsDir", Param_AppDocumentsDir);
+    if ( sparkline.values.size() < m_maxValueCount )
+    {
+        sparkline.values.push_back(value);
+    }
+    else
+    {
+        sparkline.values[sparkline.nextValueIndex] = value;
+        sparkline.nextValueIndex = (sparkline.nextValueIndex + 1) % m_maxValueCount;
+    }
 
-    AppendItemWithData("ConfigDir", Param_ConfigDir);
-    AppendItemWithData("DataDir", Param_DataDir);
-    AppendItemWithData("DocumentsDir", Param_DocumentsDir);
-    AppendItemWithData("LocalDataDir", Param_LocalDataDir);
-    AppendItemWithData("PluginsDir", Param_PluginsDir);
-    AppendItemWithData("ResourcesDir", Param_ResourcesDir);
-    AppendItemWithData("TempDir", Param_TempDir);
-    AppendItemWithData("UserConfigDir", Param_UserConfigDir);
-    AppendItemWithData("UserDataDir", Param_UserDataDir);
-    AppendItemWithData("UserLocalDataDir", Param_UserLocalDataDir);
+    sparkline.dirty = true;
+}
 
-#if wxCHECK_VERSION(3, 1, 0)
-    AppendItemWithData("UserDir_Cache", Param_UserDir_Cache);
-    AppendItemWithData("UserDir_Documents", Param_UserDir_Documents);
-    AppendItemWithData("UserDir_Desktop", Param_UserDir_Desktop);
-    AppendItemWithData("UserDir_Downloads", Param_UserDir_Downloads);
-    AppendItemWithData("UserDir_Music", Param_UserDir_Music);
-    AppendItemWithData("UserDir_Pictures", Param_UserDir_Pictures);
-    AppendItemWithData("UserDir_Videos", Param_UserDir_Videos);
-#endif // #if wxCHECK_VERSION(3, 1, 0)
+void ListViewSparklines::Update()
+{
+    if ( !m_imageList )
+    {
+        m_imageList = new wxImageList(m_imageSize.GetWidth(), m_imageSize.GetHeight(), false);
+        m_listView->AssignImageList(m_imageList, wxIMAGE_LIST_SMALL);
+    }
 
-#ifdef __WXMSW__
-    AppendItemWithData("MSWShellDir CSIDL_DESKTOP", Param_CSIDL_DESKTOP);
-    AppendItemWithData("MSWShellDir CSIDL_INTERNET", Param_CSIDL_INTERNET);
-    AppendItemWithData("MSWShellDir CSIDL_PROGRAMS", Param_CSIDL_PROGRAMS);
-    AppendItemWithData("MSWShellDir CSIDL_CONTROLS", Param_CSIDL_CONTROLS);
-    AppendItemWithData("MSWShellDir CSIDL_PRINTERS", Param_CSIDL_PRINTERS);
-    AppendItemWithData("MSWShellDir CSIDL_FAVORITES", Param_CSIDL_FAVORITES);
-    AppendItemWithData("MSWShellDir CSIDL_STARTUP", Param_CSIDL_STARTUP);
-    AppendItemWithData("MSWShellDir CSIDL_RECENT", Param_CSIDL_RECENT);
-    AppendItemWithData("MSWShellDir CSIDL_SENDTO", Param_CSIDL_SENDTO);
-    AppendItemWithData("MSWShellDir CSIDL_BITBUCKET", Param_CSIDL_BITBUCKET);
-    AppendItemWithData("MSWShellDir CSIDL_STARTMENU", Param_CSIDL_STARTMENU);
-    AppendItemWithData("MSWShellDir CSIDL_MYDOCUMENTS", Param_CSIDL_MYDOCUMENTS);
-    AppendItemWithData("MSWShellDir CSIDL_MYMUSIC", Param_CSIDL_MYMUSIC);
-    AppendItemWithData("MSWShellDir CSIDL_MYVIDEO", Param_CSIDL_MYVIDEO);
-    AppendItemWithData("MSWShellDir CSIDL_DESKTOPDIRECTORY", Param_CSIDL_DESKTOPDIRECTORY);
-    AppendItemWithData("MSWShellDir CSIDL_DRIVES", Param_CSIDL_DRIVES);
-    AppendItemWithData("MSWShellDir CSIDL_NETWORK", Param_CSIDL_NETWORK);
-    AppendItemWithData("MSWShellDir CSIDL_NETHOOD", Param_CSIDL_NETHOOD);
-    AppendItemWithData("MSWShellDir CSIDL_FONTS", Param_CSIDL_FONTS);
-    AppendItemWithData("MSWShellDir CSIDL_TEMPLATES", Param_CSIDL_TEMPLATES);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_STARTMENU", Param_CSIDL_COMMON_STARTMENU);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_PROGRAMS", Param_CSIDL_COMMON_PROGRAMS);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_STARTUP", Param_CSIDL_COMMON_STARTUP);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_DESKTOPDIRECTORY", Param_CSIDL_COMMON_DESKTOPDIRECTORY);
-    AppendItemWithData("MSWShellDir CSIDL_APPDATA", Param_CSIDL_APPDATA);
-    AppendItemWithData("MSWShellDir CSIDL_PRINTHOOD", Param_CSIDL_PRINTHOOD);
-    AppendItemWithData("MSWShellDir CSIDL_LOCAL_APPDATA", Param_CSIDL_LOCAL_APPDATA);
-    AppendItemWithData("MSWShellDir CSIDL_ALTSTARTUP", Param_CSIDL_ALTSTARTUP);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_ALTSTARTUP", Param_CSIDL_COMMON_ALTSTARTUP);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_FAVORITES", Param_CSIDL_COMMON_FAVORITES);
-    AppendItemWithData("MSWShellDir CSIDL_INTERNET_CACHE", Param_CSIDL_INTERNET_CACHE);
-    AppendItemWithData("MSWShellDir CSIDL_COOKIES", Param_CSIDL_COOKIES);
-    AppendItemWithData("MSWShellDir CSIDL_HISTORY", Param_CSIDL_HISTORY);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_APPDATA", Param_CSIDL_COMMON_APPDATA);
-    AppendItemWithData("MSWShellDir CSIDL_WINDOWS", Param_CSIDL_WINDOWS);
-    AppendItemWithData("MSWShellDir CSIDL_SYSTEM", Param_CSIDL_SYSTEM);
-    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES", Param_CSIDL_PROGRAM_FILES);
-    AppendItemWithData("MSWShellDir CSIDL_MYPICTURES", Param_CSIDL_MYPICTURES);
-    AppendItemWithData("MSWShellDir CSIDL_PROFILE", Param_CSIDL_PROFILE);
-    AppendItemWithData("MSWShellDir CSIDL_SYSTEMX86", Param_CSIDL_SYSTEMX86);
-    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILESX86", Param_CSIDL_PROGRAM_FILESX86);
-    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES_COMMON", Param_CSIDL_PROGRAM_FILES_COMMON);
-    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES_COMMONX86", Param_CSIDL_PROGRAM_FILES_COMMONX86);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_TEMPLATES", Param_CSIDL_COMMON_TEMPLATES);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_DOCUMENTS", Param_CSIDL_COMMON_DOCUMENTS);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_ADMINTOOLS", Param_CSIDL_COMMON_ADMINTOOLS);
-    AppendItemWithData("MSWShellDir CSIDL_ADMINTOOLS", Param_CSIDL_ADMINTOOLS);
-    AppendItemWithData("MSWShellDir CSIDL_CONNECTIONS", Param_CSIDL_CONNECTIONS);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_MUSIC", Param_CSIDL_COMMON_MUSIC);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_PICTURES", Param_CSIDL_COMMON_PICTURES);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_VIDEO", Param_CSIDL_COMMON_VIDEO);
-    AppendItemWithData("MSWShellDir CSIDL_RESOURCES", Param_CSIDL_RESOURCES);
-    AppendItemWithData("MSWShellDir CSIDL_RESOURCES_LOCALIZED", Param_CSIDL_RESOURCES_LOCALIZED);
-    AppendItemWithData("MSWShellDir CSIDL_COMMON_OEM_LINKS", Param_CSIDL_COMMON_OEM_LINKS);
-    AppendItemWithData("MSWShellDir CSIDL_COMPUTERSNEARME", Param_CSIDL_COMPUTERSNEARME);
-#endif // #ifdef __WXMSW__
+    for ( auto& idAndSparkline : m_sparklines )
+    {
+        Sparkline& sparkline = idAndSparkline.second;
 
-#ifdef __WXGTK__
-    AppendItemWithData("InstallPrefix", Param_InstallPrefix);
-#endif // #ifdef __WXGTK__
+        if ( !sparkline.dirty )
+            continue;
 
-    UpdateValues();
+        const long itemIndex = m_listView->FindStoredItem(-1, idAndSparkline.first);
+
+        if ( itemIndex == wxNOT_FOUND )
+            continue;
+
+        const wxBitmap bitmap = CreateSparklineBitmap(sparkline);
+
+        if ( sparkline.imageIndex == -1 )
+            sparkline.imageIndex = m_imageList->Add(bitmap);
+        else
+            m_imageList->Replace(sparkline.imageIndex, bitmap);
+
+        m_listView->SetStoredItemColumnImage(itemIndex, m_column, sparkline.imageIndex);
+        sparkline.dirty = false;
+    }
 }
 
-void StandardPathsView::DoUpdateValues()
+wxBitmap ListViewSparklines::CreateSparklineBitmap(const Sparkline& sparkline) const
 {
-    const wxStandardPaths& paths = wxStandardPaths::Get();
-    const int itemCount = GetItemCount();
+    const size_t valueCount = sparkline.values.size();
+    const size_t oldestValueIndex = valueCount < m_maxValueCount ? 0 : sparkline.nextValueIndex;
+    const int width = m_imageSize.GetWidth();
+    const int height = m_imageSize.GetHeight();
+    const double maxValue = *std::max_element(sparkline.values.begin(), sparkline.values.end());
 
-#ifdef __WXMSW__
-    // for MSWGetShellDir()
-    // CSIDL_FLAG_DONT_VERIFY | CSIDL_FLAG_DONT_UNEXPAND | CSIDL_FLAG_NO_ALIAS
-    const UINT flags =  0x4000 | 0x2000 | 0x1000;
-#endif // #ifdef __WXMSW__
+    wxBitmap bitmap(m_imageSize);
+    wxMemoryDC memoryDC(bitmap);
+    std::vector<wxPoint> points;
 
-    for ( int i = 0; i < itemCount; ++i )
+    memoryDC.SetBackground(wxBrush(m_listView->GetBackgroundColour()));
+    memoryDC.Clear();
+    memoryDC.SetPen(wxPen(m_listView->GetForegroundColour()));
+
+    points.reserve(valueCount);
+    for ( size_t i = 0; i < valueCount; ++i )
     {
-        const long param = GetItemData(i);
-        wxString value;
+        const double value = sparkline.values[(oldestValueIndex + i) % valueCount];
+        // the newest value is at the right edge
+        const int x = width - 1 - static_cast<int>((valueCount - 1 - i) * (width - 1) / (m_maxValueCount - 1));
+        const int y = height - 2 - (maxValue > 0 ? static_cast<int>(std::max(0.0, value) / maxValue * (height - 3)) : 0);
 
-        switch ( param )
-        {
-            case Param_ExecutablePath:   value = paths.GetExecutablePath(); break;
-            case Param_AppDocumentsDir:  value = paths.GetAppDocumentsDir(); break;
-            case Param_ConfigDir:        value = paths.GetConfigDir(); break;
-            case Param_DataDir:          value = paths.GetDataDir(); break;
-            case Param_DocumentsDir:     value = paths.GetDocumentsDir(); break;
-            case Param_LocalDataDir:     value = paths.GetLocalDataDir(); break;
-            case Param_PluginsDir:       value = paths.GetPluginsDir(); break;
-            case Param_ResourcesDir:     value = paths.GetResourcesDir(); break;
-            case Param_TempDir:          value = paths.GetTempDir(); break;
-            case Param_UserConfigDir:    value = paths.GetUserConfigDir(); break;
-            case Param_UserDataDir:      value = paths.GetUserDataDir(); break;
-            case Param_UserLocalDataDir: value = paths.GetUserLocalDataDir(); break;
+        points.push_back(wxPoint(x, y));
+    }
 
-#if wxCHECK_VERSION(3, 1, 0)
-            case Param_UserDir_Cache:     value = paths.GetUserDir(wxStandardPaths::Dir_Cache); break;
-            case Param_UserDir_Documents: value = paths.GetUserDir(wxStandardPaths::Dir_Documents); break;
-            case Param_UserDir_Desktop:   value = paths.GetUserDir(wxStandardPaths::Dir_Desktop); break;
-            case Param_UserDir_Downloads: value = paths.GetUserDir(wxStandardPaths::Dir_Downloads); break;
-            case Param_UserDir_Music:     value = paths.GetUserDir(wxStandardPaths::Dir_Music); break;
-            case Param_UserDir_Pictures:  value = paths.GetUserDir(wxStandardPaths::Dir_Pictures); break;
-            case Param_UserDir_Videos:    value = paths.GetUserDir(wxStandardPaths::Dir_Videos); break;
-#endif // #if wxCHECK_VERSION(3, 1, 0)
+    if ( points.size() > 1 )
+        memoryDC.DrawLines(points.size(), points.data());
+    else if ( points.size() == 1 )
+        memoryDC.DrawPoint(points[0].x, points[0].y);
 
-#ifdef __WXMSW__
-            case Param_CSIDL_DESKTOP:                 value = paths.MSWGetShellDir(0x0000 | flags); break;
-            case Param_CSIDL_INTERNET:                value = paths.MSWGetShellDir(0x0001 | flags); break;
-            case Param_CSIDL_PROGRAMS:                value = paths.MSWGetShellDir(0x0002 | flags); break;
-            case Param_CSIDL_CONTROLS:                value = paths.MSWGetShellDir(0x0003 | flags); break;
-            case Param_CSIDL_PRINTERS:                value = paths.MSWGetShellDir(0x0004 | flags); break;
-            case Param_CSIDL_FAVORITES:               value = paths.MSWGetShellDir(0x0006 | flags); break;
-            case Param_CSIDL_STARTUP:                 value = paths.MSWGetShellDir(0x0007 | flags); break;
-            case Param_CSIDL_RECENT:                  value = paths.MSWGetShellDir(0x0008 | flags); break;
-            case Param_CSIDL_SENDTO:                  value = paths.MSWGetShellDir(0x0009 | flags); break;
-            case Param_CSIDL_BITBUCKET:               value = paths.MSWGetShellDir(0x000a | flags); break;
-            case Param_CSIDL_STARTMENU:               value = paths.MSWGetShellDir(0x000b | flags); break;
-            case Param_CSIDL_MYDOCUMENTS:             value = paths.MSWGetShellDir(0x0005 | flags); break;
-            case Param_CSIDL_MYMUSIC:                 value = paths.MSWGetShellDir(0x000d | flags); break;
-            case Param_CSIDL_MYVIDEO:                 value = paths.MSWGetShellDir(0x000e | flags); break;
-            case Param_CSIDL_DESKTOPDIRECTORY:        value = paths.MSWGetShellDir(0x0010 | flags); break;
-            case Param_CSIDL_DRIVES:                  value = paths.MSWGetShellDir(0x0011 | flags); break;
-            case Param_CSIDL_NETWORK:                 value = paths.MSWGetShellDir(0x0012 | flags); break;
-            case Param_CSIDL_NETHOOD:                 value = paths.MSWGetShellDir(0x0013 | flags); break;
-            case Param_CSIDL_FONTS:                   value = paths.MSWGetShellDir(0x0014 | flags); break;
-            case Param_CSIDL_TEMPLATES:               value = paths.MSWGetShellDir(0x0015 | flags); break;
-            case Param_CSIDL_COMMON_STARTMENU:        value = paths.MSWGetShellDir(0x0016 | flags); break;
-            case Param_CSIDL_COMMON_PROGRAMS:         value = paths.MSWGetShellDir(0X0017 | flags); break;
-            case Param_CSIDL_COMMON_STARTUP:          value = paths.MSWGetShellDir(0x0018 | flags); break;
-            case Param_CSIDL_COMMON_DESKTOPDIRECTORY: value = paths.MSWGetShellDir(0x0019 | flags); break;
-            case Param_CSIDL_APPDATA:                 value = paths.MSWGetShellDir(0x001a | flags); break;
-            case Param_CSIDL_PRINTHOOD:               value = paths.MSWGetShellDir(0x001b | flags); break;
-            case Param_CSIDL_LOCAL_APPDATA:           value = paths.MSWGetShellDir(0x001c | flags); break;
-            case Param_CSIDL_ALTSTARTUP:              value = paths.MSWGetShellDir(0x001d | flags); break;
-            case Param_CSIDL_COMMON_ALTSTARTUP:       value = paths.MSWGetShellDir(0x001e | flags); break;
-            case Param_CSIDL_COMMON_FAVORITES:        value = paths.MSWGetShellDir(0x001f | flags); break;
-            case Param_CSIDL_INTERNET_CACHE:          value = paths.MSWGetShellDir(0x0020 | flags); break;
-            case Param_CSIDL_COOKIES:                 value = paths.MSWGetShellDir(0x0021 | flags); break;
-            case Param_CSIDL_HISTORY:                 value = paths.MSWGetShellDir(0x0022 | flags); break;
-            case Param_CSIDL_COMMON_APPDATA:          value = paths.MSWGetShellDir(0x0023 | flags); break;
-            case Param_CSIDL_WINDOWS:                 value = paths.MSWGetShellDir(0x0024 | flags); break;
-            case Param_CSIDL_SYSTEM:                  value = paths.MSWGetShellDir(0x0025 | flags); break;
-            case Param_CSIDL_PROGRAM_FILES:           value = paths.MSWGetShellDir(0x0026 | flags); break;
-            case Param_CSIDL_MYPICTURES:              value = paths.MSWGetShellDir(0x0027 | flags); break;
-            case Param_CSIDL_PROFILE:                 value = paths.MSWGetShellDir(0x0028 | flags); break;
-            case Param_CSIDL_SYSTEMX86:               value = paths.MSWGetShellDir(0x0029 | flags); break;
-            case Param_CSIDL_PROGRAM_FILESX86:        value = paths.MSWGetShellDir(0x002a | flags); break;
-            case Param_CSIDL_PROGRAM_FILES_COMMON:    value = paths.MSWGetShellDir(0x002b | flags); break;
-            case Param_CSIDL_PROGRAM_FILES_COMMONX86: value = paths.MSWGetShellDir(0x002c | flags); break;
-            case Param_CSIDL_COMMON_TEMPLATES:        value = paths.MSWGetShellDir(0x002d | flags); break;
-            case Param_CSIDL_COMMON_DOCUMENTS:        value = paths.MSWGetShellDir(0x002e | flags); break;
-            case Param_CSIDL_COMMON_ADMINTOOLS:       value = paths.MSWGetShellDir(0x002f | flags); break;
-            case Param_CSIDL_ADMINTOOLS:              value = paths.MSWGetShellDir(0x0030 | flags); break;
-            case Param_CSIDL_CONNECTIONS:             value = paths.MSWGetShellDir(0x0031 | flags); break;
-            case Param_CSIDL_COMMON_MUSIC:            value = paths.MSWGetShellDir(0x0035 | flags); break;
-            case Param_CSIDL_COMMON_PICTURES:         value = paths.MSWGetShellDir(0x0036 | flags); break;
-            case Param_CSIDL_COMMON_VIDEO:            value = paths.MSWGetShellDir(0x0037 | flags); break;
-            case Param_CSIDL_RESOURCES:               value = paths.MSWGetShellDir(0x0038 | flags); break;
-            case Param_CSIDL_RESOURCES_LOCALIZED:     value = paths.MSWGetShellDir(0x0039 | flags); break;
-            case Param_CSIDL_COMMON_OEM_LINKS:        value = paths.MSWGetShellDir(0x003a | flags); break;
-            case Param_CSIDL_COMPUTERSNEARME:         value = paths.MSWGetShellDir(0x003d | flags); break;
-#endif // #ifdef __WXMSW__
-
-#ifdef __WXGTK__
-            case Param_InstallPrefix:  value = paths.GetInstallPrefix(); break;
-#endif // #ifdef __WXGTK__
-
-            default:
-                wxFAIL;
-        }
+    memoryDC.SelectObject(wxNullBitmap);
 
-        SetItem(i, Column_Value, value);
-    }
+    return bitmap;
 }
 
 
 /*************************************************
 
-    EnvironmentVariablesView
+    SystemSettingView
 
 *************************************************/
 
-class EnvironmentVariablesView : public SysInfoListView
+class SystemSettingView : public SysInfoListView
 {
 public:
-    EnvironmentVariablesView(wxWindow* parent);
+    SystemSettingView(wxWindow* parent);
 
     wxArrayString GetValues(const wxString& separator) const override
     {
         return GetNameAndValueValues(Column_Name, Column_Value, separator);
     }
-
 protected:
-    void DoUpdateValues() override;
-private:
     enum
     {
         Column_Name = 0,
         Column_Value,
+        Column_Description
     };
 };
 
-EnvironmentVariablesView::EnvironmentVariablesView(wxWindow* parent)
+SystemSettingView::SystemSettingView(wxWindow* parent)
     : SysInfoListView(parent)
 {
     InsertColumn(Column_Name, _("Name"));
     InsertColumn(Column_Value, _("Value"));
-
-    UpdateValues();
-}
-
-void EnvironmentVariablesView::DoUpdateValues()
-{
-    DeleteAllItems();
-
-    wxEnvVariableHashMap variables;
-
-    if ( !wxGetEnvMap(&variables) )
-    {
-        wxLogError(_("Could not retrieve system environment variables."));
-        return;
-    }
-
-    // sort variables alphabetically by name
-    std::map<wxString, wxString> variablesSorted;
-
-    for ( auto i = variables.begin(); i != variables.end(); ++i )
-        variablesSorted[i->first] = i->second;
-
-    for ( const auto& variable : variablesSorted )
-    {
-         const long itemIndex = InsertItem(GetItemCount(), variable.first);
-
-         if ( itemIndex != -1 )
-            SetItem(itemIndex, Column_Value, variable.second);
-    }
+    InsertColumn(Column_Description, _("Description"));
 }
 
 
 /*************************************************
 
-    MiscellaneousView
+    SystemColourView
 
 *************************************************/
 
-class ObtainFullHostNameThread;
-
-class MiscellaneousView : public SysInfoListView
+class SystemColourView : public SystemSettingView
 {
 public:
-    MiscellaneousView(wxWindow* parent);
-    ~MiscellaneousView();
+    SystemColourView(wxWindow* parent);
+    ~SystemColourView();
 
-    wxArrayString GetValues(const wxString& separator) const override
-    {
-        return GetNameAndValueValues(Column_Name, Column_Value, separator);
-    }
+    bool CanShowDetailedInformation() const override { return GetFirstSelectedStoredItem() != -1; }
+
+    void SetColourBitmapOutlineColour(const wxColour& outlineColour);
+    wxColour GetColourBitmapOutlineColour() const { return m_outlineColour; }
 
+    static wxColour GetDefaultColourBitmapOutlineColour();
 protected:
     void DoUpdateValues() override;
+    void DoShowDetailedInformation(long listItemIndex) const override;
 private:
-    enum
-    {
-        Column_Name = 0,
-        Column_Value,
-    };
-
-    enum
-    {
-        Param_AppName = 0,
-        Param_AppDisplayName,
-        Param_AppVendorName,
-        Param_AppVendorDisplayName,
-        Param_AppClassName,
-        Param_AppHasStderr,
-        Param_IsProcess64bit,
-        Param_wxRCEmbedded,
-        Param_UnixDesktopEnvironment,
-        Param_ThemeName,
-        Param_SystemAppearanceName,
-        Param_SystemAppearanceIsDark,
-        Param_SystemAppearanceIsSystemDark,
-        Param_SystemAppearanceAreAppsDark,
-        Param_ComCtl32Version,
-        Param_GDIObjectCount,
-        Param_UserObjectCount,
-        Param_IsProcessDPIAware,
-        Param_ProcessDPIAwareness,
-        Param_ThreadDPIAwarenessContext,
-        Param_ProcessSystemDPI,
-        Param_WindowDPI,
-        Param_WindowContentScaleFactor,
-        Param_PathSeparator,
-        Param_UserId,
-        Param_UserName,
-        Param_SystemEncodingName,
-        Param_SystemLanguage,
-#if wxCHECK_VERSION(3, 1, 6)
-        Param_UILocaleName,
-#endif
-        Param_HostName,
-        Param_FullHostName,
-        Param_OSDescription,
-        Param_OSVersion,
-        Param_LinuxDistributionInfo,
-        Param_OSDirectory,
-        Param_CPUArchitectureName,
-        Param_CPUCount,
-        Param_IsPlatform64Bit,
-        Param_IsPlatformLittleEndian,
-    };
+    wxImageList* m_imageList{nullptr};
+    wxColour m_outlineColour;
+    std::set<wxSystemColour> m_deprecatedColourList;
 
-    ObtainFullHostNameThread* m_obtainFullHostNameThread{nullptr};
+    wxBitmap CreateColourBitmap(const wxColour& colour, const wxSize& size);
 
-    void OnObtainFullHostNameThread(wxThreadEvent& event);
-    void StartObtainFullHostNameThread();
-    void StopObtainFullHostNameThread();
+    void CreateDeprecatedColourList();
+    bool IsDeprecatedSystemColour(wxSystemColour index);
 };
 
-#ifdef __WXMSW__
-
-class MSWDPIAwarenessHelper
+struct ColourInfo
 {
-public:
-    enum ProcessDPIAwareness
-    {
-        ProcessDPIUnaware         = 0,
-        ProcessSystemDPIAware     = 1,
-        ProcessPerMonitorDPIAware = 2,
-        ProcessDPINotApplicable   = 33333, // returned on error/unsupported
-    };
-
-    enum DPIAwarenessContext
-    {
-        DPIAwarenessContextUnaware           = -1,
-        DPIAwarenessContextSystemAware       = -2,
-        DPIAwarenessContextPerMonitorAware   = -3,
-        DPIAwarenessContextPerMonitorAwareV2 = -4,
-        DPIAwarenessContextUnawareGdiscaled  = -5,
-        DPIAwarenessContextNotApplicable     = -66666, // returned on error/unsupported
-    };
-
-    static bool IsThisProcessDPIAware();
-    static ProcessDPIAwareness GetThisProcessDPIAwareness();
-    static wxString GetThisProcessDPIAwarenessStr();
-    static unsigned GetSystemDpiForThisProcess();
-    static unsigned GetDpiForWindow(wxWindow* win);
+    wxSystemColour index;
+    const char*    name;
+    const char*    description;
+};
 
-    static DPIAwarenessContext GetThreadDPIAwarenessContext();
-    static wxString GetThreadDPIAwarenessContextStr();
+ColourInfo const s_colourInfoArray[] =
+{
+    wxSYS_COLOUR_SCROLLBAR, "wxSYS_COLOUR_SCROLLBAR", "The scrollbar grey area.",
+    wxSYS_COLOUR_DESKTOP, "wxSYS_COLOUR_DESKTOP", "The desktop colour.",
+    wxSYS_COLOUR_ACTIVECAPTION, "wxSYS_COLOUR_ACTIVECAPTION", "Active window caption colour.",
+    wxSYS_COLOUR_INACTIVECAPTION, "wxSYS_COLOUR_INACTIVECAPTION", "Inactive window caption colour.",
+    wxSYS_COLOUR_MENU, "wxSYS_COLOUR_MENU", "Menu background colour.",
+    wxSYS_COLOUR_WINDOW, "wxSYS_COLOUR_WINDOW", "Window background colour.",
+    wxSYS_COLOUR_WINDOWFRAME, "wxSYS_COLOUR_WINDOWFRAME", "Window frame colour.",
+    wxSYS_COLOUR_MENUTEXT, "wxSYS_COLOUR_MENUTEXT", "Colour of the text used in the menus.",
+    wxSYS_COLOUR_WINDOWTEXT, "wxSYS_COLOUR_WINDOWTEXT", "Colour of the text used in generic windows.",
+    wxSYS_COLOUR_CAPTIONTEXT, "wxSYS_COLOUR_CAPTIONTEXT", "Colour of the text used in captions, size boxes and scrollbar arrow boxes.",
+    wxSYS_COLOUR_ACTIVEBORDER, "wxSYS_COLOUR_ACTIVEBORDER", "Active window border colour.",
+    wxSYS_COLOUR_INACTIVEBORDER, "wxSYS_COLOUR_INACTIVEBORDER", "Inactive window border colour.",
+    wxSYS_COLOUR_APPWORKSPACE, "wxSYS_COLOUR_APPWORKSPACE", "Background colour for MDI applications.",
+    wxSYS_COLOUR_HIGHLIGHT, "wxSYS_COLOUR_HIGHLIGHT", "Colour of item(s) selected in a control.",
+    wxSYS_COLOUR_HIGHLIGHTTEXT, "wxSYS_COLOUR_HIGHLIGHTTEXT", "Colour of the text of item(s) selected in a control.",
+    wxSYS_COLOUR_BTNFACE, "wxSYS_COLOUR_BTNFACE", "Face shading colour on push buttons.",
+    wxSYS_COLOUR_BTNSHADOW, "wxSYS_COLOUR_BTNSHADOW", "Edge shading colour on push buttons.",
+    wxSYS_COLOUR_GRAYTEXT, "wxSYS_COLOUR_GRAYTEXT", "Colour of greyed (disabled) text.",
+    wxSYS_COLOUR_BTNTEXT, "wxSYS_COLOUR_BTNTEXT", "Colour of the text on push buttons.",
+    wxSYS_COLOUR_INACTIVECAPTIONTEXT, "wxSYS_COLOUR_INACTIVECAPTIONTEXT", "Colour of the text in active captions.",
+    wxSYS_COLOUR_BTNHIGHLIGHT, "wxSYS_COLOUR_BTNHIGHLIGHT", "Highlight colour for buttons.",
+    wxSYS_COLOUR_3DDKSHADOW, "wxSYS_COLOUR_3DDKSHADOW", "Dark shadow colour for three-dimensional display elements.",
+    wxSYS_COLOUR_3DLIGHT, "wxSYS_COLOUR_3DLIGHT", "Light colour for three-dimensional display elements.",
+    wxSYS_COLOUR_INFOTEXT, "wxSYS_COLOUR_INFOTEXT", "Text colour for tooltip controls.",
+    wxSYS_COLOUR_INFOBK, "wxSYS_COLOUR_INFOBK", "Background colour for tooltip controls.",
+    wxSYS_COLOUR_LISTBOX, "wxSYS_COLOUR_LISTBOX", "Background colour for list-like controls.",
+    wxSYS_COLOUR_HOTLIGHT, "wxSYS_COLOUR_HOTLIGHT", "Colour for a hyperlink or hot-tracked item.",
+    wxSYS_COLOUR_GRADIENTACTIVECAPTION, "wxSYS_COLOUR_GRADIENTACTIVECAPTION", "Right side colour in the color gradient of an active window's title bar.",
+    wxSYS_COLOUR_GRADIENTINACTIVECAPTION, "wxSYS_COLOUR_GRADIENTINACTIVECAPTION", "Right side colour in the color gradient of an inactive window's title bar.",
+    wxSYS_COLOUR_MENUHILIGHT, "wxSYS_COLOUR_MENUHILIGHT", "The colour used to highlight menu items when the menu appears as a flat menu.",
+    wxSYS_COLOUR_MENUBAR, "wxSYS_COLOUR_MENUBAR", "The background colour for the menu bar when menus appear as flat menus.",
+    wxSYS_COLOUR_LISTBOXTEXT, "wxSYS_COLOUR_LISTBOXTEXT", "Text colour for list-like controls.",
+    wxSYS_COLOUR_LISTBOXHIGHLIGHTTEXT, "wxSYS_COLOUR_LISTBOXHIGHLIGHTTEXT", "Text colour for the unfocused selection of list-like controls.",
+    wxSYS_COLOUR_BACKGROUND, "wxSYS_COLOUR_BACKGROUND", "Synonym for wxSYS_COLOUR_DESKTOP.",
+    wxSYS_COLOUR_3DFACE, "wxSYS_COLOUR_3DFACE", "Synonym for wxSYS_COLOUR_BTNFACE.",
+    wxSYS_COLOUR_3DSHADOW, "wxSYS_COLOUR_3DSHADOW", "Synonym for wxSYS_COLOUR_BTNSHADOW.",
+    wxSYS_COLOUR_BTNHILIGHT, "wxSYS_COLOUR_BTNHILIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
+    wxSYS_COLOUR_3DHIGHLIGHT, "wxSYS_COLOUR_3DHIGHLIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
+    wxSYS_COLOUR_3DHILIGHT, "wxSYS_COLOUR_3DHILIGHT", "Synonym for wxSYS_COLOUR_BTNHIGHLIGHT.",
+    wxSYS_COLOUR_FRAMEBK, "wxSYS_COLOUR_FRAMEBK", "Synonym for wxSYS_COLOUR_BTNFACE.",
 };
 
-bool MSWDPIAwarenessHelper::IsThisProcessDPIAware()
+SystemColourView::SystemColourView(wxWindow* parent)
+    : SystemSettingView(parent)
 {
-    using IsProcessDPIAware_t = BOOL(WINAPI*)();
+    CreateDeprecatedColourList();
 
-    static bool s_initialised = false;
-    static IsProcessDPIAware_t s_pfnIsProcessDPIAware = nullptr;
+    SetColourBitmapOutlineColour(GetDefaultColourBitmapOutlineColour());
 
-    if ( !s_initialised )
+    for ( size_t i = 0; i < WXSIZEOF(s_colourInfoArray); ++i )
     {
-        wxLoadedDLL dllUser32("user32.dll");
+        if ( IsDeprecatedSystemColour(s_colourInfoArray[i].index) )
+            continue;
 
-        wxDL_INIT_FUNC(s_pfn, IsProcessDPIAware, dllUser32);
-        s_initialised = true;
+         const wxString colourName = s_colourInfoArray[i].name;
+         const wxString colourDescription = s_colourInfoArray[i].description;
+         const long itemIndex = AddStoredItem(colourName);
+
+         if ( itemIndex != -1 )
+         {
+             SetStoredItem(itemIndex, Column_Description, colourDescription);
+             SetStoredItemData(itemIndex, (long)i);
+         }
     }
 
-    if ( !s_pfnIsProcessDPIAware )
-        return false;
+    UpdateValues();
+}
 
-    return s_pfnIsProcessDPIAware() == TRUE;
+SystemColourView::~SystemColourView()
+{
+    if ( m_imageList )
+        delete m_imageList;
 }
 
-MSWDPIAwarenessHelper::ProcessDPIAwareness MSWDPIAwarenessHelper::GetThisProcessDPIAwareness()
+void SystemColourView::SetColourBitmapOutlineColour(const wxColour& outlineColour)
 {
-    using GetProcessDpiAwareness_t = HRESULT(WINAPI*)(HANDLE, DWORD*);
+    m_outlineColour = outlineColour;
+    UpdateValues();
+}
 
-    static bool s_initialised = false;
-    static wxDynamicLibrary s_dllShcore;
-    static GetProcessDpiAwareness_t s_pfnGetProcessDpiAwareness = nullptr;
+wxColour SystemColourView::GetDefaultColourBitmapOutlineColour()
+{
+    const wxColour defaultOutlineColour(202, 31, 123); // magenta
 
-    if ( !s_initialised )
-    {
-        if ( s_dllShcore.Load("shcore.dll", wxDL_VERBATIM | wxDL_QUIET) )
-        {
-            wxDL_INIT_FUNC(s_pfn, GetProcessDpiAwareness, s_dllShcore);
+    return defaultOutlineColour;
+}
 
-            if ( !s_pfnGetProcessDpiAwareness )
-                s_dllShcore.Unload();
-        }
+void SystemColourView::DoUpdateValues()
+{
+    wxSize size;
 
-        s_initialised = true;
+    if ( m_imageList )
+    {
+        SetImageList(nullptr, wxIMAGE_LIST_SMALL);
+        delete m_imageList;
     }
 
-    if ( !s_pfnGetProcessDpiAwareness )
-        return ProcessDPINotApplicable;
+    m_imageList = new wxImageList();
 
-    DWORD value = ProcessDPINotApplicable;
-    const HRESULT hr = s_pfnGetProcessDpiAwareness(nullptr, &value);
+    size.SetWidth(wxSystemSettings::GetMetric(wxSYS_SMALLICON_X, this));
+    size.SetHeight(wxSystemSettings::GetMetric(wxSYS_SMALLICON_Y, this));
 
-    if ( FAILED(hr) )
+    // work around wxSystemSettings::GetMetric(wxSYS_SMALLICON_{X|Y}) value
+    // being unavailable
+    if ( !size.IsFullySpecified() )
     {
-        wxLogApiError("GetProcessDpiAwareness", hr);
-        return ProcessDPINotApplicable;
+        size.Set(16, 16);
+#if wxCHECK_VERSION(3, 1, 0)
+        size = FromDIP(size);
+#endif
     }
 
-    if ( value == ProcessDPIUnaware )
-        return ProcessDPIUnaware;
-    if ( value == ProcessSystemDPIAware )
-        return ProcessSystemDPIAware;
-    if ( value == ProcessPerMonitorDPIAware )
-        return ProcessPerMonitorDPIAware;
+    m_imageList->Create(size.GetWidth(), size.GetHeight(), false);
+    SetImageList(m_imageList, wxIMAGE_LIST_SMALL);
 
-    return ProcessDPINotApplicable;
+    const int itemCount = GetStoredItemCount();
+    wxString colourValue;
+
+    for ( int i = 0; i < itemCount; ++i )
+    {
+         const wxColour colour = wxSystemSettings::GetColour(s_colourInfoArray[GetStoredItemData(i)].index);
+         const int imageIndex = m_imageList->Add(CreateColourBitmap(colour.IsOk() ? colour : GetColourBitmapOutlineColour(), size));
+
+         colourValue = _("<Invalid>");
+
+         if ( colour.IsOk() )
+         {
+             colourValue = m_valueFormatter.Colour(colour);
+
+             if ( !colour.IsSolid() )
+                 colourValue += _(", not solid");
+         }
+
+         SetStoredItem(i, Column_Value, colourValue, imageIndex);
+    }
 }
 
-wxString MSWDPIAwarenessHelper::GetThisProcessDPIAwarenessStr()
+void SystemColourView::DoShowDetailedInformation(long listItemIndex) const
 {
-    const ProcessDPIAwareness awareness = GetThisProcessDPIAwareness();
-    wxString result;
+    const size_t infoArrayIndex = GetStoredItemData(listItemIndex);
+    const wxString valueName = s_colourInfoArray[infoArrayIndex].name;
+    const wxColour colour = wxSystemSettings::GetColour(s_colourInfoArray[infoArrayIndex].index);
 
-    switch ( awareness )
+    if ( !colour.IsOk() )
     {
-        case ProcessDPIUnaware:
-            result = _("DPI Unaware");
-            break;
-        case ProcessSystemDPIAware:
-            result = _("System DPI Aware");
-            break;
-        case ProcessPerMonitorDPIAware:
-            result = _("Per Monitor DPI Aware");
-            break;
-        default:
-            result = _("<Not Applicable / Unknown>");
+        wxLogError(_("Invalid colour for \"%s\"."), valueName);
+        return;
     }
 
-    return result;
-}
-
-unsigned MSWDPIAwarenessHelper::GetSystemDpiForThisProcess()
-{
-    using GetSystemDpiForProcess_t = unsigned(WINAPI*)(HANDLE);
+    wxColourData colourData;
 
-    static bool s_initialised = false;
-    static GetSystemDpiForProcess_t s_pfnGetSystemDpiForProcess = nullptr;
+    colourData.SetCustomColour(0, colour);
 
-    if ( !s_initialised )
-    {
-        wxLoadedDLL dllUser32("user32.dll");
+    wxGetColourFromUser(GetParent(), colour, wxString::Format(_("Viewing %s"), valueName), &colourData);
+}
 
-        wxDL_INIT_FUNC(s_pfn, GetSystemDpiForProcess, dllUser32);
-        s_initialised = true;
-    }
+wxBitmap SystemColourView::CreateColourBitmap(const wxColour& colour, const wxSize& size)
+{
+    wxBitmap bitmap(size);
+    wxMemoryDC memoryDC(bitmap);
+    wxBrush brush(colour);
+    wxPen pen(m_outlineColour, FromDIP(1));
+    wxDCPenChanger penChanger(memoryDC, pen);
+    wxDCBrushChanger brushChanger(memoryDC, brush);
 
-    if ( !s_pfnGetSystemDpiForProcess )
-        return 96;
+    memoryDC.DrawRectangle(wxRect(size));
+    memoryDC.SelectObject(wxNullBitmap);
 
-    return s_pfnGetSystemDpiForProcess(nullptr);
+    return bitmap;
 }
 
-unsigned MSWDPIAwarenessHelper::GetDpiForWindow(wxWindow* win)
+void SystemColourView::CreateDeprecatedColourList()
 {
-    using GetDpiForWindow_t = unsigned (WINAPI*)(HWND);
+#ifdef __WXMSW__
+// most system colors are deprecated in Windows 10 and newer
+// see https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-getsyscolor
 
-    static bool s_initialised = false;
-    static GetDpiForWindow_t s_pfnGetDpiForWindow = nullptr;
+    int verMajor = 0;
 
-    if ( !s_initialised )
-    {
-        wxLoadedDLL dllUser32("user32.dll");
+    wxGetOsVersion(&verMajor);
 
-        wxDL_INIT_FUNC(s_pfn, GetDpiForWindow, dllUser32);
-        s_initialised = true;
-    }
+    if ( verMajor < 10 )
+        return;
 
-    if ( !s_pfnGetDpiForWindow )
-        return 96;
+    wxCHECK_RET(m_deprecatedColourList.empty(), "list already created");
 
-    return s_pfnGetDpiForWindow(win->GetHWND());
+    m_deprecatedColourList.insert(wxSYS_COLOUR_3DDKSHADOW);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_3DHIGHLIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_3DHILIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_3DLIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_3DSHADOW);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_ACTIVEBORDER);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_ACTIVECAPTION);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_APPWORKSPACE);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_BACKGROUND);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNFACE);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNHIGHLIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNHILIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_BTNSHADOW);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_CAPTIONTEXT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_DESKTOP);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_FRAMEBK);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_GRADIENTACTIVECAPTION);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_GRADIENTINACTIVECAPTION);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVEBORDER);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVECAPTION);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_INACTIVECAPTIONTEXT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_INFOBK);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_INFOTEXT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_MENU);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUBAR);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUHILIGHT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_MENUTEXT);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_SCROLLBAR);
+    m_deprecatedColourList.insert(wxSYS_COLOUR_WINDOWFRAME);
+#endif
 }
 
-MSWDPIAwarenessHelper::DPIAwarenessContext MSWDPIAwarenessHelper::GetThreadDPIAwarenessContext()
+bool SystemColourView::IsDeprecatedSystemColour(wxSystemColour index)
 {
-    using MSW_DPI_AWARENESS_CONTEXT = HANDLE;
-    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_UNAWARE              = (MSW_DPI_AWARENESS_CONTEXT)-1;
-    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_SYSTEM_AWARE         = (MSW_DPI_AWARENESS_CONTEXT)-2;
-    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE    = (MSW_DPI_AWARENESS_CONTEXT)-3;
-    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2 = (MSW_DPI_AWARENESS_CONTEXT)-4;
-    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED    = (MSW_DPI_AWARENESS_CONTEXT)-5;
-
-    using GetThreadDpiAwarenessContext_t = MSW_DPI_AWARENESS_CONTEXT(WINAPI*)();
-    using IsValidDpiAwarenessContext_t   = BOOL(WINAPI*)(MSW_DPI_AWARENESS_CONTEXT);
-    using AreDpiAwarenessContextsEqual_t = BOOL(WINAPI*)(MSW_DPI_AWARENESS_CONTEXT, MSW_DPI_AWARENESS_CONTEXT);
-
-    static bool s_initialised = false;
-    static GetThreadDpiAwarenessContext_t s_pfnGetThreadDpiAwarenessContext = nullptr;
-    static IsValidDpiAwarenessContext_t   s_pfnIsValidDpiAwarenessContext   = nullptr;
-    static AreDpiAwarenessContextsEqual_t s_pfnAreDpiAwarenessContextsEqual = nullptr;
+#ifndef __WXMSW__
+    wxUnusedVar(index);
+    return false;
+#else
+    return m_deprecatedColourList.find(index) != m_deprecatedColourList.end();
+#endif
+}
 
-    if ( !s_initialised )
-    {
-        wxLoadedDLL dllUser32("user32.dll");
 
-        wxDL_INIT_FUNC(s_pfn, GetThreadDpiAwarenessContext, dllUser32);
-        wxDL_INIT_FUNC(s_pfn, AreDpiAwarenessContextsEqual, dllUser32);
-        wxDL_INIT_FUNC(s_pfn, IsValidDpiAwarenessContext, dllUser32);
-        s_initialised = true;
-    }
+/*************************************************
 
-    if ( !s_pfnGetThreadDpiAwarenessContext
-         || !s_pfnAreDpiAwarenessContextsEqual
-         || !s_pfnIsValidDpiAwarenessContext )
-    {
-        return DPIAwarenessContextNotApplicable;
-    }
+    SystemFontView
 
-    const MSW_DPI_AWARENESS_CONTEXT value = s_pfnGetThreadDpiAwarenessContext();
+*************************************************/
 
-    if ( !s_pfnIsValidDpiAwarenessContext(value) )
-        return DPIAwarenessContextUnaware;
+class SystemFontView : public SystemSettingView
+{
+public:
+    SystemFontView(wxWindow* parent);
 
-    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_UNAWARE) )
-        return DPIAwarenessContextUnaware;
-    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_SYSTEM_AWARE) )
-        return DPIAwarenessContextSystemAware;
-    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE) )
-        return DPIAwarenessContextPerMonitorAware;
-    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2) )
-        return DPIAwarenessContextPerMonitorAwareV2;
-    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED) )
-        return DPIAwarenessContextUnawareGdiscaled;
+    bool CanShowDetailedInformation() const override { return GetFirstSelectedStoredItem() != -1; }
 
-    return DPIAwarenessContextNotApplicable;
-}
+protected:
+    void DoUpdateValues() override;
+    void DoShowDetailedInformation(long listItemIndex) const override;
+};
 
-wxString MSWDPIAwarenessHelper::GetThreadDPIAwarenessContextStr()
+struct FontInfo
 {
-    const DPIAwarenessContext context = GetThreadDPIAwarenessContext();
-    wxString result;
+    wxSystemFont index;
+    const char*  name;
+    const char*  description;
+};
 
-    switch ( context )
+FontInfo const s_fontInfoArray[] =
+{
+    wxSYS_OEM_FIXED_FONT, "wxSYS_OEM_FIXED_FONT", "Original equipment manufacturer dependent fixed-pitch font.",
+    wxSYS_ANSI_FIXED_FONT, "wxSYS_ANSI_FIXED_FONT", "Windows fixed-pitch (monospaced) font.",
+    wxSYS_ANSI_VAR_FONT, "wxSYS_ANSI_VAR_FONT", "Windows variable-pitch (proportional) font.",
+    wxSYS_SYSTEM_FONT, "wxSYS_SYSTEM_FONT", "System font. By default, the system uses the system font to draw menus, dialog box controls, and text.",
+    wxSYS_DEVICE_DEFAULT_FONT, "wxSYS_DEVICE_DEFAULT_FONT", "Device-dependent font.",
+    wxSYS_DEFAULT_GUI_FONT, "wxSYS_DEFAULT_GUI_FONT", "Default font for user interface objects such as menus and dialog boxes.",
+};
+
+SystemFontView::SystemFontView(wxWindow* parent)
+    : SystemSettingView(parent)
+{
+    for ( size_t i = 0; i < WXSIZEOF(s_fontInfoArray); ++i )
     {
-        case DPIAwarenessContextUnaware:
-            result = _("DPI Unaware");
-            break;
-        case DPIAwarenessContextSystemAware:
-            result = _("System DPI Aware");
-            break;
-        case DPIAwarenessContextPerMonitorAware:
-            result = _("Per Monitor DPI Aware");
-            break;
-        case DPIAwarenessContextPerMonitorAwareV2:
-            result = _("Per Monitor DPI Aware V2");
-            break;
-        case DPIAwarenessContextUnawareGdiscaled:
-            result = _("DPI Unaware GDI Scaled");
-            break;
-        default:
-            result = _("<Not Applicable / Unknown>");
+         const wxString fontName = s_fontInfoArray[i].name;
+         const wxString fontDescription = s_fontInfoArray[i].description;
+         const long itemIndex = AppendItemWithData(fontName, (long)i);
+
+         if ( itemIndex != -1 )
+            SetStoredItem(itemIndex, Column_Description, fontDescription);
     }
 
-    return result;
+    UpdateValues();
 }
 
-#endif // #ifdef __WXMSW__
-
-class ObtainFullHostNameThread : public wxThread
+void SystemFontView::DoUpdateValues()
 {
-public:
-    ObtainFullHostNameThread(wxEvtHandler* sink)
-        : wxThread(wxTHREAD_JOINABLE),
-          m_sink(sink)
-    {}
+    const int itemCount = GetStoredItemCount();
 
-protected:
-    wxEvtHandler* m_sink;
+    wxLogNull logNo;
 
-    ExitCode Entry() override
+    for ( int i = 0; i < itemCount; ++i )
     {
-        wxThreadEvent evt;
+         const wxFont font = wxSystemSettings::GetFont(s_fontInfoArray[GetStoredItemData(i)].index);
+         wxString fontValue = _("<Invalid>");
 
-        evt.SetString(wxGetFullHostName());
-        wxQueueEvent(m_sink, evt.Clone());
-        return static_cast<wxThread::ExitCode>(nullptr);
-    }
-};
+         if ( font.IsOk() )
+              fontValue = font.GetNativeFontInfoUserDesc();
 
+         SetStoredItem(i, Column_Value, fontValue);
+    }
+}
 
-wxString GetThemeName()
+void SystemFontView::DoShowDetailedInformation(long listItemIndex) const
 {
-    wxString name = "<Unsupported on This Platform>";
-
-#ifdef __WXMSW__
-    static const int buffSize = 1024;
+    const size_t infoArrayIndex = GetStoredItemData(listItemIndex);
 
-    WCHAR fileName[buffSize+1]{0};
-    WCHAR colorName[buffSize+1]{0};
-    WCHAR displayName[buffSize+1]{0};
+    const wxString valueName = s_fontInfoArray[infoArrayIndex].name;
+    const wxFont font = wxSystemSettings::GetFont(s_fontInfoArray[infoArrayIndex].index);
 
-    if ( SUCCEEDED(::GetCurrentThemeName(fileName, buffSize, colorName, buffSize, nullptr, 0)) )
+    if ( !font.IsOk() )
     {
-        if ( SUCCEEDED(::GetThemeDocumentationProperty(fileName, SZ_THDOCPROP_DISPLAYNAME, displayName, buffSize)) )
-        {
-            HIGHCONTRAST hc{0};
+        wxLogError(_("Invalid font for \"%s\"."), valueName);
+        return;
+    }
 
-            name.Printf("%s / %s", displayName, colorName);
+    wxGetFontFromUser(GetParent(), font, wxString::Format(_("Viewing %s"), valueName));
+}
 
-            hc.cbSize = sizeof(hc);
-            if ( ::SystemParametersInfo(SPI_GETHIGHCONTRAST, sizeof(hc), &hc, 0) )
-            {
-                if ( (hc.dwFlags & HCF_HIGHCONTRASTON) == HCF_HIGHCONTRASTON )
-                    name += _(" (High Contrast)");
-            }
-        }
-    }
-#endif
 
-#ifdef __WXGTK__
-    GtkSettings* settings = gtk_settings_get_default();
-    gchar* themeName = nullptr;
+/*************************************************
 
-    g_object_get(settings, "gtk-theme-name", &themeName, nullptr);
-    name = wxString::FromUTF8(themeName);
-    g_free(themeName);
-#endif
+    SystemMetricView
 
-    return name;
-}
+*************************************************/
 
-MiscellaneousView::~MiscellaneousView()
+class SystemMetricView : public SystemSettingView
 {
-    StopObtainFullHostNameThread();
-}
+public:
+    SystemMetricView(wxWindow* parent);
+protected:
+    void DoUpdateValues() override;
+};
 
-MiscellaneousView::MiscellaneousView(wxWindow* parent)
-    : SysInfoListView(parent)
+
+struct MetricInfo
 {
-    InsertColumn(Column_Name, _("Name"));
-    InsertColumn(Column_Value, _("Value"));
+    wxSystemMetric index;
+    const char*    name;
+    const char*    description;
+};
 
-    AppendItemWithData(_("App Name"), Param_AppName);
-    AppendItemWithData(_("App Display Name"), Param_AppDisplayName);
-    AppendItemWithData(_("App Vendor Name"), Param_AppVendorName);
-    AppendItemWithData(_("App Vendor Display Name"), Param_AppVendorDisplayName);
-    AppendItemWithData(_("App Class Name"), Param_AppClassName);
-    AppendItemWithData(_("App HasStderr"), Param_AppHasStderr);
-    AppendItemWithData(_("64-bit Process"), Param_IsProcess64bit);
-#ifdef __WXMSW__
-    AppendItemWithData(_("Is <wx/wx.rc> Embedded"), Param_wxRCEmbedded);
-#endif // #ifdef __WXMSW__
-#ifdef __UNIX__
-    AppendItemWithData(_("Unix Desktop Environment"), Param_UnixDesktopEnvironment);
-#endif // #ifdef __UNIX__
-    AppendItemWithData(_("Theme Name"), Param_ThemeName);
-#if wxCHECK_VERSION(3, 1, 3)
-    AppendItemWithData(_("System Appearance Name"), Param_SystemAppearanceName);
-    AppendItemWithData(_("System Appearance IsDark"), Param_SystemAppearanceIsDark);
-#endif
+MetricInfo const s_metricInfoArray[] =
+{
+    wxSYS_MOUSE_BUTTONS, "wxSYS_MOUSE_BUTTONS", "Number of buttons on mouse, or zero if no mouse was installed.",
+    wxSYS_BORDER_X, "wxSYS_BORDER_X", "Width of single border.",
+    wxSYS_BORDER_Y, "wxSYS_BORDER_Y", "Height of single border.",
+    wxSYS_CURSOR_X, "wxSYS_CURSOR_X", "Width of cursor.",
+    wxSYS_CURSOR_Y, "wxSYS_CURSOR_Y", "Height of cursor.",
+    wxSYS_DCLICK_X, "wxSYS_DCLICK_X", "Width in pixels of rectangle within which two successive mouse clicks must fall to generate a double-click.",
+    wxSYS_DCLICK_Y, "wxSYS_DCLICK_Y", "Height in pixels of rectangle within which two successive mouse clicks must fall to generate a double-click.",
+    wxSYS_DRAG_X, "wxSYS_DRAG_X", "Width in pixels of a rectangle centered on a drag point to allow for limited movement of the mouse pointer before a drag operation begins.",
+    wxSYS_DRAG_Y, "wxSYS_DRAG_Y", "Height in pixels of a rectangle centered on a drag point to allow for limited movement of the mouse pointer before a drag operation begins.",
+    wxSYS_EDGE_X, "wxSYS_EDGE_X", "Width of a 3D border, in pixels.",
+    wxSYS_EDGE_Y, "wxSYS_EDGE_Y", "Height of a 3D border, in pixels.",
+    wxSYS_HSCROLL_ARROW_X, "wxSYS_HSCROLL_ARROW_X", "Width of arrow bitmap on horizontal scrollbar.",
+    wxSYS_HSCROLL_ARROW_Y, "wxSYS_HSCROLL_ARROW_Y", "Height of arrow bitmap on horizontal scrollbar.",
+    wxSYS_HTHUMB_X, "wxSYS_HTHUMB_X", "Width of horizontal scrollbar thumb.",
+    wxSYS_ICON_X, "wxSYS_ICON_X", "The default width of an icon.",
+    wxSYS_ICON_Y, "wxSYS_ICON_Y", "The default height of an icon.",
+    wxSYS_ICONSPACING_X, "wxSYS_ICONSPACING_X", "Width of a grid cell for items in large icon view, in pixels. Each item fits into a rectangle of this size when arranged.",
+    wxSYS_ICONSPACING_Y, "wxSYS_ICONSPACING_Y", "Height of a grid cell for items in large icon view, in pixels. Each item fits into a rectangle of this size when arranged.",
+    wxSYS_WINDOWMIN_X, "wxSYS_WINDOWMIN_X", "Minimum width of a window.",
+    wxSYS_WINDOWMIN_Y, "wxSYS_WINDOWMIN_Y", "Minimum height of a window.",
+    wxSYS_SCREEN_X, "wxSYS_SCREEN_X", "Width of the screen in pixels.",
+    wxSYS_SCREEN_Y, "wxSYS_SCREEN_Y", "Height of the screen in pixels.",
+    wxSYS_FRAMESIZE_X, "wxSYS_FRAMESIZE_X", "Width of the window frame for a wxTHICK_FRAME window.",
+    wxSYS_FRAMESIZE_Y, "wxSYS_FRAMESIZE_Y", "Height of the window frame for a wxTHICK_FRAME window.",
+    wxSYS_SMALLICON_X, "wxSYS_SMALLICON_X", "Recommended width of a small icon (in window captions, and small icon view).",
+    wxSYS_SMALLICON_Y, "wxSYS_SMALLICON_Y", "Recommended height of a small icon (in window captions, and small icon view).",
+    wxSYS_HSCROLL_Y, "wxSYS_HSCROLL_Y", "Height of horizontal scrollbar in pixels.",
+    wxSYS_VSCROLL_X, "wxSYS_VSCROLL_X", "Width of vertical scrollbar in pixels.",
+    wxSYS_VSCROLL_ARROW_X, "wxSYS_VSCROLL_ARROW_X", "Width of arrow bitmap on a vertical scrollbar.",
+    wxSYS_VSCROLL_ARROW_Y, "wxSYS_VSCROLL_ARROW_Y", "Height of arrow bitmap on a vertical scrollbar.",
+    wxSYS_VTHUMB_Y, "wxSYS_VTHUMB_Y", "Height of vertical scrollbar thumb.",
+    wxSYS_CAPTION_Y, "wxSYS_CAPTION_Y", "Height of normal caption area.",
+    wxSYS_MENU_Y, "wxSYS_MENU_Y", "Height of single-line menu bar.",
+    wxSYS_NETWORK_PRESENT, "wxSYS_NETWORK_PRESENT", "1 if there is a network present, 0 otherwise.",
+    wxSYS_PENWINDOWS_PRESENT, "wxSYS_PENWINDOWS_PRESENT", "1 if PenWindows is installed, 0 otherwise.",
+    wxSYS_SHOW_SOUNDS, "wxSYS_SHOW_SOUNDS", "Non-zero if the user requires an application to present information visually in situations where it would otherwise present the information only in audible form; zero otherwise.",
+    wxSYS_SWAP_BUTTONS, "wxSYS_SWAP_BUTTONS", "Non-zero if the meanings of the left and right mouse buttons are swapped; zero otherwise.",
+    wxSYS_DCLICK_MSEC, "wxSYS_DCLICK_MSEC", "Maximal time, in milliseconds, which may pass between subsequent clicks for a double click to be generated.",
 
-#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
-    AppendItemWithData(_("System Appearance IsSystemDark"), Param_SystemAppearanceIsSystemDark);
-    AppendItemWithData(_("System Appearance AreAppsDark"), Param_SystemAppearanceAreAppsDark);
-#endif //#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+// there was a bug with these three metrics on wxMSW
+// until commit e5d850d (commited on Apr 18, 2019)
+#if wxCHECK_VERSION(3, 1, 1) && ( !defined(__WXMSW__) || wxCHECK_VERSION(3, 1, 3)  )
+    wxSYS_CARET_ON_MSEC, "wxSYS_CARET_ON_MSEC", "Time, in milliseconds, for how long a blinking caret should stay visible during a single blink cycle before it disappears.",
+    wxSYS_CARET_OFF_MSEC, "wxSYS_CARET_OFF_MSEC", "Time, in milliseconds, for how long a blinking caret should stay invisible during a single blink cycle before it reappears. If this value is zero, carets should be visible all the time instead of blinking. If the value is negative, the platform does not support the user setting. Implemented only on GTK+ and MacOS X.",
+    wxSYS_CARET_TIMEOUT_MSEC, "wxSYS_CARET_TIMEOUT_MSEC", "Time, in milliseconds, for how long a caret should blink after a user interaction. After this timeout has expired, the caret should stay continuously visible until the user interacts with the caret again (for example by entering, deleting or cutting text). If this value is negative, carets should blink forever; if it is zero, carets should not blink at all.",
+#endif // #if wxCHECK_VERSION(3, 1, 1) && ( !defined(__WXMSW__) || wxCHECK_VERSION(3, 1, 3)  )
+};
 
-#ifdef __WXMSW__
-    AppendItemWithData(_("ComCtl32.dll Version"), Param_ComCtl32Version);
-    AppendItemWithData(_("GDI Object Count"), Param_GDIObjectCount);
-    AppendItemWithData(_("User Object Count"), Param_UserObjectCount);
-    AppendItemWithData(_("Is Process DPI Aware"), Param_IsProcessDPIAware);
-    AppendItemWithData(_("Process DPI Awareness"), Param_ProcessDPIAwareness);
-    AppendItemWithData(_("Thread DPI Awareness Context"), Param_ThreadDPIAwarenessContext);
-    AppendItemWithData(_("System DPI for Process"), Param_ProcessSystemDPI);
-    AppendItemWithData(_("DPI for This Window"), Param_WindowDPI);
-#endif // #ifdef __WXMSW__
+SystemMetricView::SystemMetricView(wxWindow* parent)
+    : SystemSettingView(parent)
+{
+    for ( size_t i = 0; i < WXSIZEOF(s_metricInfoArray); ++i )
+    {
+         const wxString metricName = s_metricInfoArray[i].name;
+         const wxString metricDescription = s_metricInfoArray[i].description;
+         const long itemIndex = AppendItemWithData(metricName, (long)i);
 
-    AppendItemWithData(_("Window Content Scale Factor"), Param_WindowContentScaleFactor);
-    AppendItemWithData(_("Path Separator"), Param_PathSeparator);
-    AppendItemWithData(_("User Id"), Param_UserId);
-    AppendItemWithData(_("User Name"), Param_UserName);
-    AppendItemWithData(_("System Encoding"), Param_SystemEncodingName);
-    AppendItemWithData(_("System Language"), Param_SystemLanguage);
-#if wxCHECK_VERSION(3, 1, 6)
-    AppendItemWithData(_("UI Locale Name"), Param_UILocaleName);
-#endif
-    AppendItemWithData(_("Host Name"), Param_HostName);
-    AppendItemWithData(_("Full Host Name"), Param_FullHostName);
-    AppendItemWithData(_("OS Description"), Param_OSDescription);
-    AppendItemWithData(_("OS Version"), Param_OSVersion);
-#ifdef __LINUX__
-    AppendItemWithData(_("Linux Distribution Info"), Param_LinuxDistributionInfo);
-#endif // #ifdef __LINUX__
-    AppendItemWithData(_("OS Directory"), Param_OSDirectory);
-#if wxCHECK_VERSION(3, 1, 5)
-    AppendItemWithData(_("CPU Architecture Name"), Param_CPUArchitectureName);
-#endif
-    AppendItemWithData(_("64-bit Platform"), Param_IsPlatform64Bit);
-    AppendItemWithData(_("CPU Count"), Param_CPUCount);
-    AppendItemWithData(_("Little Endian"), Param_IsPlatformLittleEndian);
+         if ( itemIndex != -1 )
+            SetStoredItem(itemIndex, Column_Description, metricDescription);
+    }
 
-    Bind(wxEVT_THREAD, &MiscellaneousView::OnObtainFullHostNameThread, this);
+    m_columnWidths[Column_Value] = wxLIST_AUTOSIZE_USEHEADER;
 
     UpdateValues();
 }
 
-void MiscellaneousView::DoUpdateValues()
+void SystemMetricView::DoUpdateValues()
 {
-    int verMajor = 0, verMinor = 0, verMicro = 0;
-    wxAppConsole* appInstance = wxAppConsole::GetInstance();
-    wxAppTraits* appTraits = appInstance->GetTraits();
-    const long itemCount = GetItemCount();
-#ifdef __WXMSW__
-    HANDLE hCurrentProcess = ::GetCurrentProcess();
-    const DWORD GDIObjectCount = ::GetGuiResources(hCurrentProcess, GR_GDIOBJECTS);
-    const DWORD UserObjectCount =  ::GetGuiResources(hCurrentProcess, GR_USEROBJECTS);
-    bool wxRCEmbedded = false;
-#endif
-#ifdef __LINUX__
-    const wxLinuxDistributionInfo linuxDistributionInfo = wxGetLinuxDistributionInfo();
-#endif // #ifdef __LINUX__
-
-#if wxCHECK_VERSION(3, 1, 3)
-    const wxSystemAppearance systemAppearance = wxSystemSettings::GetAppearance();
-#endif
+    const int itemCount = GetStoredItemCount();
 
-#ifdef __WXMSW__
+    for ( int i = 0; i < itemCount; ++i )
     {
-        wxLogNull logNo;
+         const int metricValue  = wxSystemSettings::GetMetric(s_metricInfoArray[GetStoredItemData(i)].index, wxGetTopLevelParent(this));
 
-        wxRCEmbedded = wxBitmap("wxBITMAP_STD_COLOURS").IsOk();
+         SetStoredItem(i, Column_Value, m_valueFormatter.Int(metricValue));
     }
-#endif // #ifdef __WXMSW__
+}
 
-    wxGetOsVersion(&verMajor, &verMinor, &verMicro);
 
-    StartObtainFullHostNameThread();
+/*************************************************
 
-    for ( int i = 0; i < itemCount; ++i )
-    {
-        const long param = GetItemData(i);
-        wxString value;
+    DisplaysView
+
+*************************************************/
 
-        switch ( param )
-        {
-            case Param_AppName:                   value = appInstance->GetAppName(); break;
-            case Param_AppDisplayName:            value = appInstance->GetAppDisplayName(); break;
-            case Param_AppVendorName:             value = appInstance->GetVendorName(); break;
-            case Param_AppVendorDisplayName:      value = appInstance->GetVendorDisplayName(); break;
-            case Param_AppClassName:              value = appInstance->GetClassName(); break;
-            case Param_AppHasStderr:              value = appTraits->HasStderr() ? _("Yes") : _("No"); break;
-            case Param_IsProcess64bit:            value = sizeof(void*) == 8 ? _("Yes") : _("No"); break;
 #ifdef __WXMSW__
-            case Param_wxRCEmbedded:              value = wxRCEmbedded ? _("Yes") : _("No"); break;
-#endif // #ifdef __WXMSW__
-#ifdef __UNIX__
-            case Param_UnixDesktopEnvironment:    value = appTraits->GetDesktopEnvironment(); break;
-#endif // #ifdef __UNIX__
 
-            case Param_ThemeName:                 value = GetThemeName(); break;
-#if wxCHECK_VERSION(3, 1, 3)
-            case Param_SystemAppearanceName:      value = systemAppearance.GetName(); break;
-            case Param_SystemAppearanceIsDark:    value = systemAppearance.IsDark() ? _("Yes") : _("No"); break;
-#endif
+// The code for obtaining friendly monitor names is adapted from
+// https://gist.github.com/pavel-a/dd3a4320176e69a0f6c4b4871e69e56b
 
-#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
-            case Param_SystemAppearanceIsSystemDark: value = systemAppearance.IsSystemDark() ? _("Yes") : _("No"); break;
-            case Param_SystemAppearanceAreAppsDark:  value = systemAppearance.AreAppsDark() ? _("Yes") : _("No"); break;
-#endif //#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+BOOL CALLBACK MonitorInfoEnumProc(HMONITOR hMonitor, HDC, LPRECT, LPARAM dwData)
+{
+    WinStruct<MONITORINFOEXW> info;
+    UINT32 pathCount, modeCount;
+    std::vector<DISPLAYCONFIG_PATH_INFO> paths;
+    std::vector<DISPLAYCONFIG_MODE_INFO> modes;
 
-#ifdef __WXMSW__
-            case Param_ComCtl32Version:           value.Printf("%d", wxApp::GetComCtl32Version()); break;
-            case Param_GDIObjectCount:            value = GDIObjectCount ? wxString::Format("%lu", GDIObjectCount) : _("N/A"); break;
-            case Param_UserObjectCount:           value = UserObjectCount ? wxString::Format("%lu", UserObjectCount) : _("N/A"); break;
-            case Param_IsProcessDPIAware:         value = MSWDPIAwarenessHelper::IsThisProcessDPIAware() ? _("Yes") : _("No"); break;
-            case Param_ProcessDPIAwareness:       value = MSWDPIAwarenessHelper::GetThisProcessDPIAwarenessStr(); break;
-            case Param_ThreadDPIAwarenessContext: value = MSWDPIAwarenessHelper::GetThreadDPIAwarenessContextStr(); break;
-            case Param_ProcessSystemDPI:          value.Printf("%d", MSWDPIAwarenessHelper::GetSystemDpiForThisProcess()); break;
-            case Param_WindowDPI:                 value.Printf("%d", MSWDPIAwarenessHelper::GetDpiForWindow(this)); break;
-#endif // #ifdef __WXMSW__
+    if ( !::GetMonitorInfoW(hMonitor, &info) )
+        return FALSE;
 
-            case Param_WindowContentScaleFactor:  value.Printf("%.2f", GetContentScaleFactor()); break;
-            case Param_PathSeparator:             value.Printf("%s", wxString(wxFileName::GetPathSeparator())); break;
-            case Param_UserId:                    value = wxGetUserId(); break;
-            case Param_UserName:                  value = wxGetUserName(); break;
-            case Param_SystemEncodingName:        value = wxLocale::GetSystemEncodingName(); break;
-            case Param_SystemLanguage:            value =  wxLocale::GetLanguageName(wxLocale::GetSystemLanguage()); break;
-#if wxCHECK_VERSION(3, 1, 6)
-            case Param_UILocaleName:              value =  wxUILocale::GetCurrent().GetName(); break;
-#endif
-            case Param_HostName:                  value = wxGetHostName(); break;
-            case Param_FullHostName:              value = _("<Evaluating...>"); break;
-            case Param_OSDescription:             value =  wxGetOsDescription(); break;
-            case Param_OSVersion:                 value.Printf(_("%d.%d.%d"), verMajor, verMinor, verMicro); break;
-#ifdef __LINUX__
-            case Param_LinuxDistributionInfo:     value.Printf("%s (%s)", linuxDistributionInfo.Description, linuxDistributionInfo.CodeName); break;
-#endif // #ifdef __LINUX__
-            case Param_OSDirectory:               value = wxGetOSDirectory(); break;
-#if wxCHECK_VERSION(3, 1, 5)
-            case  Param_CPUArchitectureName:      value = wxGetCpuArchitectureName(); break;
-#endif
-            case Param_IsPlatform64Bit:           value = wxIsPlatform64Bit() ? _("Yes") : _("No"); break;
-            case Param_CPUCount:                  value.Printf("%d", wxThread::GetCPUCount()); break;
-            case Param_IsPlatformLittleEndian:    value =  wxIsPlatformLittleEndian() ? _("Yes") : _("No"); break;
+    if ( ::GetDisplayConfigBufferSizes(QDC_ONLY_ACTIVE_PATHS, &pathCount, &modeCount) != ERROR_SUCCESS )
+        return FALSE;
 
-            default:
-                wxFAIL;
-        }
+    if ( !pathCount || !modeCount )
+        return FALSE;
 
-        SetItem(i, Column_Value, value);
-    }
-}
+    paths.resize(pathCount);
+    modes.resize(modeCount);
 
-void MiscellaneousView::OnObtainFullHostNameThread(wxThreadEvent& event)
-{
-    const long itemIndex = FindItem(-1, Param_FullHostName);
+    if ( ::QueryDisplayConfig(QDC_ONLY_ACTIVE_PATHS,
+            &pathCount, paths.data(), &modeCount, modes.data(), nullptr) != ERROR_SUCCESS )
+        return FALSE;
 
-    if ( itemIndex != wxNOT_FOUND )
-        SetItem(itemIndex, Column_Value, event.GetString());
-}
+    for ( const auto& p : paths )
+    {
+        DISPLAYCONFIG_SOURCE_DEVICE_NAME sourceName;
 
-void MiscellaneousView::StartObtainFullHostNameThread()
-{
-    StopObtainFullHostNameThread();
+        sourceName.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME;
+        sourceName.header.size = sizeof(sourceName);
+        sourceName.header.adapterId = p.sourceInfo.adapterId;
+        sourceName.header.id = p.sourceInfo.id;
+        if ( ::DisplayConfigGetDeviceInfo(&sourceName.header) != ERROR_SUCCESS )
+            return FALSE;
 
-    m_obtainFullHostNameThread = new ObtainFullHostNameThread(this);
-    if ( m_obtainFullHostNameThread->Run() != wxTHREAD_NO_ERROR )
-    {
-        delete m_obtainFullHostNameThread;
-        m_obtainFullHostNameThread= nullptr;
-        wxLogError(_("Could not create the thread needed to obtain the full host name."));
-    }
-}
+        if ( ::wcscmp(info.szDevice, sourceName.viewGdiDeviceName) != 0 )
+            continue;
 
-void MiscellaneousView::StopObtainFullHostNameThread()
-{
-    if ( m_obtainFullHostNameThread )
-    {
-        m_obtainFullHostNameThread->Delete();
-        delete m_obtainFullHostNameThread;
-        m_obtainFullHostNameThread = nullptr;
+        DISPLAYCONFIG_TARGET_DEVICE_NAME name;
+
+        name.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_TARGET_NAME;
+        name.header.size = sizeof(name);
+        name.header.adapterId = p.sourceInfo.adapterId;
+        name.header.id = p.targetInfo.id;
+        if ( ::DisplayConfigGetDeviceInfo(&name.header) != ERROR_SUCCESS )
+            return FALSE;
+
+        wxArrayString* friendlyNames = reinterpret_cast<wxArrayString*>(dwData);
+
+        friendlyNames->push_back(wxString(name.monitorFriendlyDeviceName));
+        return TRUE;
     }
-}
 
-/*************************************************
+    return FALSE;
+}
 
-    PreprocessorDefinesView
+#endif // #ifdef __WXMSW__
 
-*************************************************/
 
-class PreprocessorDefinesView : public SysInfoListView
+class DisplaysView : public SysInfoListView
 {
 public:
-    PreprocessorDefinesView(wxWindow* parent);
+    DisplaysView(wxWindow* parent);
 
     wxArrayString GetValues(const wxString& separator) const override
     {
-        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+        return GetAllColumnsValues(separator);
     }
 
 protected:
@@ -2065,268 +2247,1727 @@ protected:
 private:
     enum
     {
-        Column_Name = 0,
-        Column_Value,
+        Param_Name = 0,
+        Param_FriendlyName,
+        Param_IsPrimary,
+        Param_Resolution,
+        Param_BPP,
+        Param_Frequency,
+        Param_GeometryCoords,
+        Param_GeometrySize,
+        Param_ClientAreaCoords,
+        Param_ClientAreaSize,
+        Param_PPI,
+        Param_HasThisWindow
     };
 };
 
-PreprocessorDefinesView::PreprocessorDefinesView(wxWindow* parent)
+DisplaysView::DisplaysView(wxWindow* parent)
     : SysInfoListView(parent)
 {
-    InsertColumn(Column_Name, _("Name"));
-    InsertColumn(Column_Value, _("Value"));
+    AppendColumn(_("Parameter"));
+
+    AppendItemWithData(_("Name"), Param_Name);
+#ifdef __WXMSW__
+    AppendItemWithData(_("Friendly Name"), Param_FriendlyName);
+#endif
+    AppendItemWithData(_("Is Primary"), Param_IsPrimary);
+    AppendItemWithData(_("Resolution"), Param_Resolution);
+    AppendItemWithData(_("Bits Per Pixel"), Param_BPP);
+    AppendItemWithData(_("Refresh Frequency (Hz)"), Param_Frequency);
+    AppendItemWithData(_("Geometry Coordinates (left, top; right, bottom)"), Param_GeometryCoords);
+    AppendItemWithData(_("Geometry Size"), Param_GeometrySize);
+    AppendItemWithData(_("Client Area Coordinates (left, top; right, bottom)"), Param_ClientAreaCoords);
+    AppendItemWithData(_("Client Area Size"), Param_ClientAreaSize);
+    AppendItemWithData(_("Pixels Per Inch"), Param_PPI);
+    AppendItemWithData(_("Has This Window"), Param_HasThisWindow);
 
     UpdateValues();
 }
 
-wxString DefineValueToText(const wxString& name, const wxString& value)
+void DisplaysView::DoUpdateValues()
 {
-    if ( name == value )
-        return _("<Is Not Defined>");
+    while ( GetColumnCount() > 1 )
+        DeleteColumn(1);
 
-    if ( value.empty() )
-        return _("<Is Defined>");
+    const unsigned int displayCount = wxDisplay::GetCount();
+    const int displayForThisWindow = wxDisplay::GetFromWindow(wxGetTopLevelParent(this));
+    const int itemCount = GetStoredItemCount();
+    wxString value;
 
-    return value;
-}
+#ifdef __WXMSW__
+    wxArrayString friendlyNames;
 
-#define APPEND_DEFINE_ITEM(value) \
-    itemIndex = InsertItem(GetItemCount(), #value); \
-    SetItem(itemIndex, Column_Value, DefineValueToText(#value, wxSTRINGIZE_T(value)));
+    if ( !::EnumDisplayMonitors(nullptr, nullptr, MonitorInfoEnumProc, (LPARAM)&friendlyNames) )
+        friendlyNames.clear();
+#endif // #ifdef __WXMSW__
 
-#define APPEND_HAS_FEATURE_ITEM(name, value) \
-    itemIndex = InsertItem(GetItemCount(), name); \
-    SetItem(itemIndex, Column_Value, hasDefine ? _("Yes") : _("No")); \
-    hasDefine = false;
+    for ( size_t displayIndex = 0; displayIndex < displayCount; ++displayIndex )
+    {
+        const wxDisplay display(displayIndex);
+        const wxVideoMode videoMode = display.GetCurrentMode();
+        const wxRect geometryCoords = display.GetGeometry();
+        const wxRect clientAreaCoords = display.GetClientArea();
+        const int columnIndex = displayIndex + 1;
 
-void PreprocessorDefinesView::DoUpdateValues()
-{
-    // preprocessor defines cannot be
-    // changed when the application is running
-    if ( GetItemCount() > 0 )
-        return;
+        AppendColumn(wxString::Format("wxDisplay(%zu)", displayIndex));
 
-    long itemIndex;
+        for ( int itemIndex = 0; itemIndex < itemCount; ++itemIndex )
+        {
+            const int param = GetStoredItemData(itemIndex);
 
-    APPEND_DEFINE_ITEM(__cplusplus)
+            switch ( param )
+            {
+                case Param_Name:
+                    value = display.GetName();
+                    break;
+#ifdef __WXMSW__
+                case Param_FriendlyName:
+                    if ( friendlyNames.size() == displayCount )
+                        value = friendlyNames[displayIndex];
+                    else
+                        value = _("N/A");
+                    break;
+#endif // #ifdef __WXMSW__
+                case Param_IsPrimary:
+                    value =  display.IsPrimary() ? _("Yes") : _("No");
+                    break;
+                case Param_Resolution:
+                    value = m_valueFormatter.Size(wxSize(videoMode.GetWidth(), videoMode.GetHeight()));
+                    break;
+                case Param_BPP:
+                    value = m_valueFormatter.Int(videoMode.GetDepth());
+                    break;
+                case Param_Frequency:
+                    value = m_valueFormatter.Int(videoMode.refresh);
+                    break;
+                case Param_GeometryCoords:
+                    value = m_valueFormatter.Rect(geometryCoords);
+                    break;
+                case Param_GeometrySize:
+                    value = m_valueFormatter.Size(geometryCoords.GetSize());
+                    break;
+                case Param_ClientAreaCoords:
+                    value = m_valueFormatter.Rect(clientAreaCoords);
+                    break;
+                case Param_ClientAreaSize:
+                    value = m_valueFormatter.Size(clientAreaCoords.GetSize());
+                    break;
+                case Param_PPI:
+                    value = m_valueFormatter.Size(display.GetPPI());
+                    break;
+                case Param_HasThisWindow:
+                    value = displayForThisWindow == displayIndex ? _("Yes") : _("No");
+                    break;
+                default:
+                    wxFAIL;
+            }
 
-#ifdef _MSC_VER
-    APPEND_DEFINE_ITEM(_MSC_VER)
-    APPEND_DEFINE_ITEM(_MSC_FULL_VER)
-    APPEND_DEFINE_ITEM(_MSVC_LANG)
-    APPEND_DEFINE_ITEM(_DEBUG)
-    APPEND_DEFINE_ITEM(_DLL)
-#endif // #ifdef _MSC_VER
+            SetStoredItem(itemIndex, columnIndex, value);
+        }
+    }
+}
 
-#ifdef __GNUC__
-    APPEND_DEFINE_ITEM(__GNUC__)
-    APPEND_DEFINE_ITEM(__GNUC_MINOR__)
-    APPEND_DEFINE_ITEM(__GNUC_PATCHLEVEL__)
-#endif // #ifdef(__GNUC__)
 
-#ifdef __MINGW32__
-    APPEND_DEFINE_ITEM(__MINGW32__)
-    APPEND_DEFINE_ITEM(__MINGW32_MAJOR_VERSION)
-    APPEND_DEFINE_ITEM(__MINGW32_MINOR_VERSION)
-#endif
+/*************************************************
 
-#ifdef __MINGW64__
-    APPEND_DEFINE_ITEM(__MINGW64__)
-    APPEND_DEFINE_ITEM(__MINGW64_VERSION_MAJOR)
-    APPEND_DEFINE_ITEM(__MINGW64_VERSION_MINOR)
-#endif
+    SystemOptionsView
 
-#ifdef __MINGW32_TOOLCHAIN__
-    APPEND_DEFINE_ITEM(__MINGW32_TOOLCHAIN__)
-#endif
+*************************************************/
 
-#ifdef __MINGW64_TOOLCHAIN__
-    APPEND_DEFINE_ITEM(__MINGW64_TOOLCHAIN__)
-#endif
+class SystemOptionsView : public SysInfoListView
+{
+public:
+    SystemOptionsView(wxWindow* parent);
 
-#ifdef __clang__
-    APPEND_DEFINE_ITEM(__clang__)
-    APPEND_DEFINE_ITEM(__clang_major__)
-    APPEND_DEFINE_ITEM(__clang_minor__)
-    APPEND_DEFINE_ITEM(__clang_patchlevel__)
-#endif
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
 
-#ifdef __CYGWIN__
-    APPEND_DEFINE_ITEM(__CYGWIN__)
-#endif
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
 
-    APPEND_DEFINE_ITEM(NDEBUG)
+    enum
+    {
+        Param_ExitOnAssert = 0,
 
-#ifdef __WXGTK__
-    APPEND_DEFINE_ITEM(__WXGTK3__)
-#endif
+        // MSW options
 
-#ifdef __WXMSW__
-    APPEND_DEFINE_ITEM(_UNICODE)
-    APPEND_DEFINE_ITEM(WXUSINGDLL)
-#endif
+        Param_MSWDarkMode,
+        Param_MSWFontNoProofQuality,
+        Param_MSWNotebookThemedBackground,
+        Param_MSWRemap,
+        Param_MSWStaticBoxOptimizedPaint,
+        Param_MSWWindowNoClipChildren,
+        Param_MSWWindowNoComposited,
+        Param_NoMaskBit,
 
-    const long ABIVersion = wxABI_VERSION;
-    itemIndex = InsertItem(GetItemCount(), "wxABI_VERSION");
-    SetItem(itemIndex, Column_Value, wxString::Format("%ld", ABIVersion));
+        // GTK options
+        Param_GTKDesktop,
+        Param_GTKTLWCanSetTransparent,
+        Param_GTKWindowForceBackgroundColour,
 
-#ifdef WXWIN_COMPATIBILITY_2_8
-    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_2_8)
-#endif
-#ifdef WXWIN_COMPATIBILITY_3_0
-    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_3_0)
-#endif
-#ifdef WXWIN_COMPATIBILITY_3_2
-    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_3_2)
-#endif
+        // MAC options
+        Param_MacListCtrlAwaysUseGeneric,
+        Param_MacTextControlUseSpellChecker,
+        Param_MacWindowDefaultVariant,
+        Param_MacWindowPlainTransition,
+        Param_OSXFileDialogAlwaysShowTypes,
+    };
+};
 
-    itemIndex = InsertItem(GetItemCount(), "WX_BUILD_OPTIONS_SIGNATURE");
-    SetItem(itemIndex, Column_Value, WX_BUILD_OPTIONS_SIGNATURE);
+SystemOptionsView::SystemOptionsView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    AppendItemWithData(wxS("exit-on-assert"), Param_ExitOnAssert);
 
-    APPEND_DEFINE_ITEM(wxUSE_REPRODUCIBLE_BUILD)
-    APPEND_DEFINE_ITEM(wxDEBUG_LEVEL)
-    APPEND_DEFINE_ITEM(wxUSE_ON_FATAL_EXCEPTION)
-    APPEND_DEFINE_ITEM(wxUSE_STACKWALKER)
-    APPEND_DEFINE_ITEM(wxUSE_DEBUGREPORT)
-    APPEND_DEFINE_ITEM(wxUSE_DEBUG_CONTEXT)
-    APPEND_DEFINE_ITEM(wxUSE_MEMORY_TRACING)
-    APPEND_DEFINE_ITEM(wxUSE_GLOBAL_MEMORY_OPERATORS)
-    APPEND_DEFINE_ITEM(wxUSE_DEBUG_NEW_ALWAYS)
-#ifdef _MSC_VER
-    APPEND_DEFINE_ITEM(wxUSE_VC_CRTDBG)
-#endif // #ifdef _MSC_VER
 #ifdef __WXMSW__
-    APPEND_DEFINE_ITEM(wxUSE_NO_MANIFEST)
-    #if !defined(wxUSE_NO_MANIFEST) || (wxUSE_NO_MANIFEST == 0)
-        APPEND_DEFINE_ITEM(wxUSE_RC_MANIFEST)
-    #endif //#if !defined(wxUSE_NO_MANIFEST) || (wxUSE_NO_MANIFEST == 0)
-    #if defined(wxUSE_RC_MANIFEST) && wxUSE_RC_MANIFEST
-        APPEND_DEFINE_ITEM(wxUSE_DPI_AWARE_MANIFEST)
-    #endif // #if defined(wxUSE_RC_MANIFEST) && wxUSE_RC_MANIFEST
+    AppendItemWithData(wxS("msw.dark-mode"), Param_MSWDarkMode);
+    AppendItemWithData(wxS("msw.font.no-proof-quality"), Param_MSWFontNoProofQuality);
+    AppendItemWithData(wxS("msw.notebook.themed-background"), Param_MSWNotebookThemedBackground);
+    AppendItemWithData(wxS("msw.remap"), Param_MSWRemap);
+    AppendItemWithData(wxS("msw.staticbox.optimized-paint"), Param_MSWStaticBoxOptimizedPaint);
+    AppendItemWithData(wxS("msw.window.no-clip-children"), Param_MSWWindowNoClipChildren);
+    AppendItemWithData(wxS("msw.window.no-composited"), Param_MSWWindowNoComposited);
+    AppendItemWithData(wxS("no-maskblt"), Param_NoMaskBit);
 #endif // #ifdef __WXMSW__
-    APPEND_DEFINE_ITEM(wxUSE_UNICODE)
-    APPEND_DEFINE_ITEM(wxUSE_UNICODE_WCHAR)
-    APPEND_DEFINE_ITEM(wxUSE_UNICODE_UTF8)
-    APPEND_DEFINE_ITEM(wxUSE_UTF8_LOCALE_ONLY)
-    APPEND_DEFINE_ITEM(wxUSE_UNSAFE_WXSTRING_CONV)
-    APPEND_DEFINE_ITEM(wxNO_UNSAFE_WXSTRING_CONV)
-    APPEND_DEFINE_ITEM(wxNO_IMPLICIT_WXSTRING_ENCODING)
-    APPEND_DEFINE_ITEM(wxUSE_EXCEPTIONS)
-    APPEND_DEFINE_ITEM(wxUSE_EXTENDED_RTTI)
-    APPEND_DEFINE_ITEM(wxUSE_LOG)
-    APPEND_DEFINE_ITEM(wxUSE_LOGWINDOW)
-    APPEND_DEFINE_ITEM(wxUSE_LOGGUI)
-    APPEND_DEFINE_ITEM(wxUSE_LOG_DIALOG)
-    APPEND_DEFINE_ITEM(wxUSE_CMDLINE_PARSER)
-    APPEND_DEFINE_ITEM(wxUSE_THREADS)
-    APPEND_DEFINE_ITEM(wxUSE_STREAMS)
-    APPEND_DEFINE_ITEM(wxUSE_PRINTF_POS_PARAMS)
-    APPEND_DEFINE_ITEM(wxUSE_COMPILER_TLS)
-    APPEND_DEFINE_ITEM(wxUSE_STL)
-    APPEND_DEFINE_ITEM(wxUSE_STD_DEFAULT)
-    APPEND_DEFINE_ITEM(wxUSE_STD_CONTAINERS_COMPATIBLY)
-    APPEND_DEFINE_ITEM(wxUSE_STD_CONTAINERS)
-    APPEND_DEFINE_ITEM(wxUSE_STD_IOSTREAM)
-    APPEND_DEFINE_ITEM(wxUSE_STD_STRING)
-    APPEND_DEFINE_ITEM(wxUSE_STD_STRING_CONV_IN_WXSTRING)
-    APPEND_DEFINE_ITEM(wxUSE_LONGLONG)
-    APPEND_DEFINE_ITEM(wxUSE_BASE64)
-    APPEND_DEFINE_ITEM(wxUSE_CONSOLE_EVENTLOOP)
-    APPEND_DEFINE_ITEM(wxUSE_FILE)
-    APPEND_DEFINE_ITEM(wxUSE_FFILE)
-    APPEND_DEFINE_ITEM(wxUSE_FSVOLUME)
-    APPEND_DEFINE_ITEM(wxUSE_SECRETSTORE)
-    APPEND_DEFINE_ITEM(wxUSE_STDPATHS)
-    APPEND_DEFINE_ITEM(wxUSE_TEXTBUFFER)
-    APPEND_DEFINE_ITEM(wxUSE_TEXTFILE)
-    APPEND_DEFINE_ITEM(wxUSE_INTL)
-    APPEND_DEFINE_ITEM(wxUSE_XLOCALE)
-    APPEND_DEFINE_ITEM(wxUSE_DATETIME)
-    APPEND_DEFINE_ITEM(wxUSE_TIMER)
-    APPEND_DEFINE_ITEM(wxUSE_STOPWATCH)
-    APPEND_DEFINE_ITEM(wxUSE_FSWATCHER)
-    APPEND_DEFINE_ITEM(wxUSE_CONFIG)
-    APPEND_DEFINE_ITEM(wxUSE_CONFIG_NATIVE)
-    APPEND_DEFINE_ITEM(wxUSE_DIALUP_MANAGER)
-    APPEND_DEFINE_ITEM(wxUSE_DYNLIB_CLASS)
-    APPEND_DEFINE_ITEM(wxUSE_DYNAMIC_LOADER)
-    APPEND_DEFINE_ITEM(wxUSE_SOCKETS)
-    APPEND_DEFINE_ITEM(wxUSE_IPV6)
-    APPEND_DEFINE_ITEM(wxUSE_FILESYSTEM)
-    APPEND_DEFINE_ITEM(wxUSE_FS_ZIP)
-    APPEND_DEFINE_ITEM(wxUSE_FS_ARCHIVE)
-    APPEND_DEFINE_ITEM(wxUSE_FS_INET)
-    APPEND_DEFINE_ITEM(wxUSE_ARCHIVE_STREAMS)
-    APPEND_DEFINE_ITEM(wxUSE_ZIPSTREAM)
-    APPEND_DEFINE_ITEM(wxUSE_TARSTREAM)
-    APPEND_DEFINE_ITEM(wxUSE_ZLIB)
-    APPEND_DEFINE_ITEM(wxUSE_LIBLZMA)
-    APPEND_DEFINE_ITEM(wxUSE_APPLE_IEEE)
-    APPEND_DEFINE_ITEM(wxUSE_JOYSTICK)
-    APPEND_DEFINE_ITEM(wxUSE_FONTENUM)
-    APPEND_DEFINE_ITEM(wxUSE_FONTMAP)
-    APPEND_DEFINE_ITEM(wxUSE_MIMETYPE)
-    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL)
-    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_FILE)
-    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_FTP)
-    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_HTTP)
-    APPEND_DEFINE_ITEM(wxUSE_URL)
-    APPEND_DEFINE_ITEM(wxUSE_URL_NATIVE)
-    APPEND_DEFINE_ITEM(wxUSE_VARIANT)
-    APPEND_DEFINE_ITEM(wxUSE_ANY)
-    APPEND_DEFINE_ITEM(wxUSE_REGEX)
-    APPEND_DEFINE_ITEM(wxUSE_SYSTEM_OPTIONS)
-    APPEND_DEFINE_ITEM(wxUSE_SOUND)
-    APPEND_DEFINE_ITEM(wxUSE_MEDIACTRL)
-    APPEND_DEFINE_ITEM(wxUSE_XRC)
-    APPEND_DEFINE_ITEM(wxUSE_XML)
-    APPEND_DEFINE_ITEM(wxUSE_AUI)
-    APPEND_DEFINE_ITEM(wxUSE_RIBBON)
-    APPEND_DEFINE_ITEM(wxUSE_PROPGRID)
-    APPEND_DEFINE_ITEM(wxUSE_STC)
-    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW)
-#ifdef __WXMSW__
-    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_IE)
-    #ifdef wxUSE_WEBVIEW_EDGE
-        APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_EDGE)
-    #endif
-    #ifdef wxUSE_WEBVIEW_EDGE_STATIC
-        APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_EDGE_STATIC)
-    #endif
-#else
-    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_WEBKIT)
-#endif // #else
+
 #ifdef __WXGTK__
-    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_WEBKIT2)
+    AppendItemWithData(wxS("gtk.desktop"), Param_GTKDesktop);
+    AppendItemWithData(wxS("gtk.tlw.can-set-transparent"), Param_GTKTLWCanSetTransparent);
+    AppendItemWithData(wxS("gtk.window.force-background-colour"), Param_GTKWindowForceBackgroundColour);
 #endif // #ifdef __WXGTK__
 
-    APPEND_DEFINE_ITEM(wxUSE_GRAPHICS_CONTEXT)
-    APPEND_DEFINE_ITEM(wxUSE_CAIRO)
-    APPEND_DEFINE_ITEM(wxUSE_CONTROLS)
-    APPEND_DEFINE_ITEM(wxUSE_MARKUP)
-    APPEND_DEFINE_ITEM(wxUSE_POPUPWIN)
-    APPEND_DEFINE_ITEM(wxUSE_TIPWINDOW)
-    APPEND_DEFINE_ITEM(wxUSE_ACTIVITYINDICATOR)
-    APPEND_DEFINE_ITEM(wxUSE_ANIMATIONCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_BANNERWINDOW)
-    APPEND_DEFINE_ITEM(wxUSE_BUTTON)
-    APPEND_DEFINE_ITEM(wxUSE_BMPBUTTON)
-    APPEND_DEFINE_ITEM(wxUSE_CALENDARCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_CHECKBOX)
-    APPEND_DEFINE_ITEM(wxUSE_CHOICE)
-    APPEND_DEFINE_ITEM(wxUSE_COLLPANE)
-    APPEND_DEFINE_ITEM(wxUSE_COLOURPICKERCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_COMBOBOX)
-    APPEND_DEFINE_ITEM(wxUSE_COMMANDLINKBUTTON)
-    APPEND_DEFINE_ITEM(wxUSE_DATAVIEWCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_DATEPICKCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_DIRPICKERCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_EDITABLELISTBOX)
-    APPEND_DEFINE_ITEM(wxUSE_FILECTRL)
-    APPEND_DEFINE_ITEM(wxUSE_FILEPICKERCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_FONTPICKERCTRL)
-    APPEND_DEFINE_ITEM(wxUSE_GAUGE)
-    APPEND_DEFINE_ITEM(wxUSE_HEADERCTRL)
+#ifdef __WXMAC__
+    AppendItemWithData(wxS("mac.listctrl.always_use_generic"), Param_MacListCtrlAwaysUseGeneric);
+    AppendItemWithData(wxS("mac.textcontrol-use-spell-checker"), Param_MacTextControlUseSpellChecker);
+    AppendItemWithData(wxS("window-default-variant"), Param_MacWindowDefaultVariant);
+    AppendItemWithData(wxS("mac.window-plain-transition"), Param_MacWindowPlainTransition);
+    AppendItemWithData(wxS("osx.openfiledialog.always-show-types"), Param_OSXFileDialogAlwaysShowTypes);
+#endif // #ifdef __WXMAC__
+
+    UpdateValues();
+}
+
+wxString SysOptToString(const wxString& name)
+{
+    if ( wxSystemOptions::HasOption(name) )
+        return wxSystemOptions::GetOption(name);
+
+    return _("<Not Set>");
+}
+
+void SystemOptionsView::DoUpdateValues()
+{
+    const long itemCount = GetStoredItemCount();
+
+    for ( int i = 0; i < itemCount; ++i )
+    {
+        const long param = GetStoredItemData(i);
+        wxString value;
+
+        switch ( param )
+        {
+            case Param_ExitOnAssert: value = SysOptToString(wxS("exit-on-assert")); break;
+
+            case Param_MSWDarkMode:                 value = SysOptToString(wxS("msw.dark-mode")); break;
+            case Param_MSWFontNoProofQuality:       value = SysOptToString(wxS("msw.font.no-proof-quality")); break;
+            case Param_MSWNotebookThemedBackground: value = SysOptToString(wxS("msw.notebook.themed-background")); break;
+            case Param_MSWRemap:                    value = SysOptToString(wxS("msw.remap")); break;
+            case Param_MSWStaticBoxOptimizedPaint:  value = SysOptToString(wxS("msw.staticbox.optimized-paint")); break;
+            case Param_MSWWindowNoClipChildren:     value = SysOptToString(wxS("msw.window.no-clip-children")); break;
+            case Param_MSWWindowNoComposited:       value = SysOptToString(wxS("msw.window.no-composited")); break;
+            case Param_NoMaskBit:                   value = SysOptToString(wxS("no-maskblt")); break;
+
+            case Param_GTKDesktop:                     value = SysOptToString(wxS("gtk.desktop")); break;
+            case Param_GTKTLWCanSetTransparent:        value = SysOptToString(wxS("gtk.tlw.can-set-transparent")); break;
+            case Param_GTKWindowForceBackgroundColour: value = SysOptToString(wxS("gtk.window.force-background-colour")); break;
+
+            case Param_MacListCtrlAwaysUseGeneric:    value = SysOptToString(wxS("mac.listctrl.always_use_generic")); break;
+            case Param_MacTextControlUseSpellChecker: value = SysOptToString(wxS("mac.textcontrol-use-spell-checker")); break;
+            case Param_MacWindowDefaultVariant:       value = SysOptToString(wxS("window-default-variant")); break;
+            case Param_MacWindowPlainTransition:      value = SysOptToString(wxS("mac.window-plain-transition")); break;
+            case Param_OSXFileDialogAlwaysShowTypes:  value = SysOptToString(wxS("osx.openfiledialog.always-show-types")); break;
+        }
+
+        SetStoredItem(i, Column_Value, value);
+    }
+}
+
+
+/*************************************************
+
+    StandardPathsView
+
+*************************************************/
+
+class StandardPathsView : public SysInfoListView
+{
+public:
+    StandardPathsView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+    // the paths are constant or can change with the user settings,
+    // the free space of their volumes can change any time
+    int GetVolatilities() const override { return Volatility_All; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+        Column_Volume,
+    };
+
+    enum
+    {
+        Param_ExecutablePath = 0,
+        Param_AppDocumentsDir,
+        Param_ConfigDir,
+        Param_DataDir,
+        Param_DocumentsDir,
+        Param_LocalDataDir,
+        Param_PluginsDir,
+        Param_ResourcesDir,
+        Param_TempDir,
+        Param_UserConfigDir,
+        Param_UserDataDir,
+        Param_UserLocalDataDir,
+
+        // the group below is available only for wxWidgets 3.1+
+        Param_UserDir_Cache,
+        Param_UserDir_Documents,
+        Param_UserDir_Desktop,
+        Param_UserDir_Downloads,
+        Param_UserDir_Music,
+        Param_UserDir_Pictures,
+        Param_UserDir_Videos,
+
+        // the group below is available only for wxMSW
+        Param_CSIDL_DESKTOP,
+        Param_CSIDL_INTERNET,
+        Param_CSIDL_PROGRAMS,
+        Param_CSIDL_CONTROLS,
+        Param_CSIDL_PRINTERS,
+        Param_CSIDL_FAVORITES,
+        Param_CSIDL_STARTUP,
+        Param_CSIDL_RECENT,
+        Param_CSIDL_SENDTO,
+        Param_CSIDL_BITBUCKET,
+        Param_CSIDL_STARTMENU,
+        Param_CSIDL_MYDOCUMENTS,
+        Param_CSIDL_MYMUSIC,
+        Param_CSIDL_MYVIDEO,
+        Param_CSIDL_DESKTOPDIRECTORY,
+        Param_CSIDL_DRIVES,
+        Param_CSIDL_NETWORK,
+        Param_CSIDL_NETHOOD,
+        Param_CSIDL_FONTS,
+        Param_CSIDL_TEMPLATES,
+        Param_CSIDL_COMMON_STARTMENU,
+        Param_CSIDL_COMMON_PROGRAMS,
+        Param_CSIDL_COMMON_STARTUP,
+        Param_CSIDL_COMMON_DESKTOPDIRECTORY,
+        Param_CSIDL_APPDATA,
+        Param_CSIDL_PRINTHOOD,
+        Param_CSIDL_LOCAL_APPDATA,
+        Param_CSIDL_ALTSTARTUP,
+        Param_CSIDL_COMMON_ALTSTARTUP,
+        Param_CSIDL_COMMON_FAVORITES,
+        Param_CSIDL_INTERNET_CACHE,
+        Param_CSIDL_COOKIES,
+        Param_CSIDL_HISTORY,
+        Param_CSIDL_COMMON_APPDATA,
+        Param_CSIDL_WINDOWS,
+        Param_CSIDL_SYSTEM,
+        Param_CSIDL_PROGRAM_FILES,
+        Param_CSIDL_MYPICTURES,
+        Param_CSIDL_PROFILE,
+        Param_CSIDL_SYSTEMX86,
+        Param_CSIDL_PROGRAM_FILESX86,
+        Param_CSIDL_PROGRAM_FILES_COMMON,
+        Param_CSIDL_PROGRAM_FILES_COMMONX86,
+        Param_CSIDL_COMMON_TEMPLATES,
+        Param_CSIDL_COMMON_DOCUMENTS,
+        Param_CSIDL_COMMON_ADMINTOOLS,
+        Param_CSIDL_ADMINTOOLS,
+        Param_CSIDL_CONNECTIONS,
+        Param_CSIDL_COMMON_MUSIC,
+        Param_CSIDL_COMMON_PICTURES,
+        Param_CSIDL_COMMON_VIDEO,
+        Param_CSIDL_RESOURCES,
+        Param_CSIDL_RESOURCES_LOCALIZED,
+        Param_CSIDL_COMMON_OEM_LINKS,
+        Param_CSIDL_COMPUTERSNEARME,
+
+        // GTK only
+        Param_InstallPrefix,
+    };
+
+#ifdef __LINUX__
+    std::vector<LinuxMountInfo> m_mounts;
+    // the descriptions of the volumes already queried during the update,
+    // the mount point is the key
+    std::map<wxString, wxString> m_volumeDescriptions;
+#endif
+
+    static Volatility GetParamVolatility(long param);
+
+    // returns the mount point (Linux only) and free space of the volume with the path
+    wxString GetVolumeDescription(const wxString& path);
+};
+
+StandardPathsView::StandardPathsView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+    InsertColumn(Column_Volume, _("Volume"));
+
+    AppendItemWithData("ExecutablePath", Param_ExecutablePath);
+    AppendItemWithData("AppDocumentsDir", Param_AppDocumentsDir);
+
+    AppendItemWithData("ConfigDir", Param_ConfigDir);
+    AppendItemWithData("DataDir", Param_DataDir);
+    AppendItemWithData("DocumentsDir", Param_DocumentsDir);
+    AppendItemWithData("LocalDataDir", Param_LocalDataDir);
+    AppendItemWithData("PluginsDir", Param_PluginsDir);
+    AppendItemWithData("ResourcesDir", Param_ResourcesDir);
+    AppendItemWithData("TempDir", Param_TempDir);
+    AppendItemWithData("UserConfigDir", Param_UserConfigDir);
+    AppendItemWithData("UserDataDir", Param_UserDataDir);
+    AppendItemWithData("UserLocalDataDir", Param_UserLocalDataDir);
+
+#if wxCHECK_VERSION(3, 1, 0)
+    AppendItemWithData("UserDir_Cache", Param_UserDir_Cache);
+    AppendItemWithData("UserDir_Documents", Param_UserDir_Documents);
+    AppendItemWithData("UserDir_Desktop", Param_UserDir_Desktop);
+    AppendItemWithData("UserDir_Downloads", Param_UserDir_Downloads);
+    AppendItemWithData("UserDir_Music", Param_UserDir_Music);
+    AppendItemWithData("UserDir_Pictures", Param_UserDir_Pictures);
+    AppendItemWithData("UserDir_Videos", Param_UserDir_Videos);
+#endif // #if wxCHECK_VERSION(3, 1, 0)
+
+#ifdef __WXMSW__
+    AppendItemWithData("MSWShellDir CSIDL_DESKTOP", Param_CSIDL_DESKTOP);
+    AppendItemWithData("MSWShellDir CSIDL_INTERNET", Param_CSIDL_INTERNET);
+    AppendItemWithData("MSWShellDir CSIDL_PROGRAMS", Param_CSIDL_PROGRAMS);
+    AppendItemWithData("MSWShellDir CSIDL_CONTROLS", Param_CSIDL_CONTROLS);
+    AppendItemWithData("MSWShellDir CSIDL_PRINTERS", Param_CSIDL_PRINTERS);
+    AppendItemWithData("MSWShellDir CSIDL_FAVORITES", Param_CSIDL_FAVORITES);
+    AppendItemWithData("MSWShellDir CSIDL_STARTUP", Param_CSIDL_STARTUP);
+    AppendItemWithData("MSWShellDir CSIDL_RECENT", Param_CSIDL_RECENT);
+    AppendItemWithData("MSWShellDir CSIDL_SENDTO", Param_CSIDL_SENDTO);
+    AppendItemWithData("MSWShellDir CSIDL_BITBUCKET", Param_CSIDL_BITBUCKET);
+    AppendItemWithData("MSWShellDir CSIDL_STARTMENU", Param_CSIDL_STARTMENU);
+    AppendItemWithData("MSWShellDir CSIDL_MYDOCUMENTS", Param_CSIDL_MYDOCUMENTS);
+    AppendItemWithData("MSWShellDir CSIDL_MYMUSIC", Param_CSIDL_MYMUSIC);
+    AppendItemWithData("MSWShellDir CSIDL_MYVIDEO", Param_CSIDL_MYVIDEO);
+    AppendItemWithData("MSWShellDir CSIDL_DESKTOPDIRECTORY", Param_CSIDL_DESKTOPDIRECTORY);
+    AppendItemWithData("MSWShellDir CSIDL_DRIVES", Param_CSIDL_DRIVES);
+    AppendItemWithData("MSWShellDir CSIDL_NETWORK", Param_CSIDL_NETWORK);
+    AppendItemWithData("MSWShellDir CSIDL_NETHOOD", Param_CSIDL_NETHOOD);
+    AppendItemWithData("MSWShellDir CSIDL_FONTS", Param_CSIDL_FONTS);
+    AppendItemWithData("MSWShellDir CSIDL_TEMPLATES", Param_CSIDL_TEMPLATES);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_STARTMENU", Param_CSIDL_COMMON_STARTMENU);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_PROGRAMS", Param_CSIDL_COMMON_PROGRAMS);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_STARTUP", Param_CSIDL_COMMON_STARTUP);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_DESKTOPDIRECTORY", Param_CSIDL_COMMON_DESKTOPDIRECTORY);
+    AppendItemWithData("MSWShellDir CSIDL_APPDATA", Param_CSIDL_APPDATA);
+    AppendItemWithData("MSWShellDir CSIDL_PRINTHOOD", Param_CSIDL_PRINTHOOD);
+    AppendItemWithData("MSWShellDir CSIDL_LOCAL_APPDATA", Param_CSIDL_LOCAL_APPDATA);
+    AppendItemWithData("MSWShellDir CSIDL_ALTSTARTUP", Param_CSIDL_ALTSTARTUP);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_ALTSTARTUP", Param_CSIDL_COMMON_ALTSTARTUP);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_FAVORITES", Param_CSIDL_COMMON_FAVORITES);
+    AppendItemWithData("MSWShellDir CSIDL_INTERNET_CACHE", Param_CSIDL_INTERNET_CACHE);
+    AppendItemWithData("MSWShellDir CSIDL_COOKIES", Param_CSIDL_COOKIES);
+    AppendItemWithData("MSWShellDir CSIDL_HISTORY", Param_CSIDL_HISTORY);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_APPDATA", Param_CSIDL_COMMON_APPDATA);
+    AppendItemWithData("MSWShellDir CSIDL_WINDOWS", Param_CSIDL_WINDOWS);
+    AppendItemWithData("MSWShellDir CSIDL_SYSTEM", Param_CSIDL_SYSTEM);
+    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES", Param_CSIDL_PROGRAM_FILES);
+    AppendItemWithData("MSWShellDir CSIDL_MYPICTURES", Param_CSIDL_MYPICTURES);
+    AppendItemWithData("MSWShellDir CSIDL_PROFILE", Param_CSIDL_PROFILE);
+    AppendItemWithData("MSWShellDir CSIDL_SYSTEMX86", Param_CSIDL_SYSTEMX86);
+    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILESX86", Param_CSIDL_PROGRAM_FILESX86);
+    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES_COMMON", Param_CSIDL_PROGRAM_FILES_COMMON);
+    AppendItemWithData("MSWShellDir CSIDL_PROGRAM_FILES_COMMONX86", Param_CSIDL_PROGRAM_FILES_COMMONX86);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_TEMPLATES", Param_CSIDL_COMMON_TEMPLATES);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_DOCUMENTS", Param_CSIDL_COMMON_DOCUMENTS);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_ADMINTOOLS", Param_CSIDL_COMMON_ADMINTOOLS);
+    AppendItemWithData("MSWShellDir CSIDL_ADMINTOOLS", Param_CSIDL_ADMINTOOLS);
+    AppendItemWithData("MSWShellDir CSIDL_CONNECTIONS", Param_CSIDL_CONNECTIONS);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_MUSIC", Param_CSIDL_COMMON_MUSIC);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_PICTURES", Param_CSIDL_COMMON_PICTURES);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_VIDEO", Param_CSIDL_COMMON_VIDEO);
+    AppendItemWithData("MSWShellDir CSIDL_RESOURCES", Param_CSIDL_RESOURCES);
+    AppendItemWithData("MSWShellDir CSIDL_RESOURCES_LOCALIZED", Param_CSIDL_RESOURCES_LOCALIZED);
+    AppendItemWithData("MSWShellDir CSIDL_COMMON_OEM_LINKS", Param_CSIDL_COMMON_OEM_LINKS);
+    AppendItemWithData("MSWShellDir CSIDL_COMPUTERSNEARME", Param_CSIDL_COMPUTERSNEARME);
+#endif // #ifdef __WXMSW__
+
+#ifdef __WXGTK__
+    AppendItemWithData("InstallPrefix", Param_InstallPrefix);
+#endif // #ifdef __WXGTK__
+
+    UpdateValues();
+}
+
+StandardPathsView::Volatility StandardPathsView::GetParamVolatility(long param)
+{
+    switch ( param )
+    {
+        // these depend only on the executable location or the install prefix
+        case Param_ExecutablePath:
+        case Param_ConfigDir:
+        case Param_DataDir:
+        case Param_LocalDataDir:
+        case Param_PluginsDir:
+        case Param_ResourcesDir:
+        case Param_InstallPrefix:
+            return Volatility_Constant;
+
+        // the user directories can be relocated by the user
+        default:
+            return Volatility_OnEvent;
+    }
+}
+
+void StandardPathsView::DoUpdateValues()
+{
+    const wxStandardPaths& paths = wxStandardPaths::Get();
+    const int itemCount = GetStoredItemCount();
+
+#ifdef __WXMSW__
+    // for MSWGetShellDir()
+    // CSIDL_FLAG_DONT_VERIFY | CSIDL_FLAG_DONT_UNEXPAND | CSIDL_FLAG_NO_ALIAS
+    const UINT flags =  0x4000 | 0x2000 | 0x1000;
+#endif // #ifdef __WXMSW__
+
+#ifdef __LINUX__
+    m_mounts = ParseLinuxMountInfo();
+    m_volumeDescriptions.clear();
+#endif
+
+    for ( int i = 0; i < itemCount; ++i )
+    {
+        const long param = GetStoredItemData(i);
+        wxString value;
+
+        if ( !IsUpdatingVolatility(GetParamVolatility(param)) )
+        {
+            // only the free space of the volume is refreshed
+            if ( IsUpdatingVolatility(Volatility_Live) )
+                SetStoredItem(i, Column_Volume, GetVolumeDescription(GetStoredItemText(i, Column_Value)));
+            continue;
+        }
+
+        switch ( param )
+        {
+            case Param_ExecutablePath:   value = paths.GetExecutablePath(); break;
+            case Param_AppDocumentsDir:  value = paths.GetAppDocumentsDir(); break;
+            case Param_ConfigDir:        value = paths.GetConfigDir(); break;
+            case Param_DataDir:          value = paths.GetDataDir(); break;
+            case Param_DocumentsDir:     value = paths.GetDocumentsDir(); break;
+            case Param_LocalDataDir:     value = paths.GetLocalDataDir(); break;
+            case Param_PluginsDir:       value = paths.GetPluginsDir(); break;
+            case Param_ResourcesDir:     value = paths.GetResourcesDir(); break;
+            case Param_TempDir:          value = paths.GetTempDir(); break;
+            case Param_UserConfigDir:    value = paths.GetUserConfigDir(); break;
+            case Param_UserDataDir:      value = paths.GetUserDataDir(); break;
+            case Param_UserLocalDataDir: value = paths.GetUserLocalDataDir(); break;
+
+#if wxCHECK_VERSION(3, 1, 0)
+            case Param_UserDir_Cache:     value = paths.GetUserDir(wxStandardPaths::Dir_Cache); break;
+            case Param_UserDir_Documents: value = paths.GetUserDir(wxStandardPaths::Dir_Documents); break;
+            case Param_UserDir_Desktop:   value = paths.GetUserDir(wxStandardPaths::Dir_Desktop); break;
+            case Param_UserDir_Downloads: value = paths.GetUserDir(wxStandardPaths::Dir_Downloads); break;
+            case Param_UserDir_Music:     value = paths.GetUserDir(wxStandardPaths::Dir_Music); break;
+            case Param_UserDir_Pictures:  value = paths.GetUserDir(wxStandardPaths::Dir_Pictures); break;
+            case Param_UserDir_Videos:    value = paths.GetUserDir(wxStandardPaths::Dir_Videos); break;
+#endif // #if wxCHECK_VERSION(3, 1, 0)
+
+#ifdef __WXMSW__
+            case Param_CSIDL_DESKTOP:                 value = paths.MSWGetShellDir(0x0000 | flags); break;
+            case Param_CSIDL_INTERNET:                value = paths.MSWGetShellDir(0x0001 | flags); break;
+            case Param_CSIDL_PROGRAMS:                value = paths.MSWGetShellDir(0x0002 | flags); break;
+            case Param_CSIDL_CONTROLS:                value = paths.MSWGetShellDir(0x0003 | flags); break;
+            case Param_CSIDL_PRINTERS:                value = paths.MSWGetShellDir(0x0004 | flags); break;
+            case Param_CSIDL_FAVORITES:               value = paths.MSWGetShellDir(0x0006 | flags); break;
+            case Param_CSIDL_STARTUP:                 value = paths.MSWGetShellDir(0x0007 | flags); break;
+            case Param_CSIDL_RECENT:                  value = paths.MSWGetShellDir(0x0008 | flags); break;
+            case Param_CSIDL_SENDTO:                  value = paths.MSWGetShellDir(0x0009 | flags); break;
+            case Param_CSIDL_BITBUCKET:               value = paths.MSWGetShellDir(0x000a | flags); break;
+            case Param_CSIDL_STARTMENU:               value = paths.MSWGetShellDir(0x000b | flags); break;
+            case Param_CSIDL_MYDOCUMENTS:             value = paths.MSWGetShellDir(0x0005 | flags); break;
+            case Param_CSIDL_MYMUSIC:                 value = paths.MSWGetShellDir(0x000d | flags); break;
+            case Param_CSIDL_MYVIDEO:                 value = paths.MSWGetShellDir(0x000e | flags); break;
+            case Param_CSIDL_DESKTOPDIRECTORY:        value = paths.MSWGetShellDir(0x0010 | flags); break;
+            case Param_CSIDL_DRIVES:                  value = paths.MSWGetShellDir(0x0011 | flags); break;
+            case Param_CSIDL_NETWORK:                 value = paths.MSWGetShellDir(0x0012 | flags); break;
+            case Param_CSIDL_NETHOOD:                 value = paths.MSWGetShellDir(0x0013 | flags); break;
+            case Param_CSIDL_FONTS:                   value = paths.MSWGetShellDir(0x0014 | flags); break;
+            case Param_CSIDL_TEMPLATES:               value = paths.MSWGetShellDir(0x0015 | flags); break;
+            case Param_CSIDL_COMMON_STARTMENU:        value = paths.MSWGetShellDir(0x0016 | flags); break;
+            case Param_CSIDL_COMMON_PROGRAMS:         value = paths.MSWGetShellDir(0X0017 | flags); break;
+            case Param_CSIDL_COMMON_STARTUP:          value = paths.MSWGetShellDir(0x0018 | flags); break;
+            case Param_CSIDL_COMMON_DESKTOPDIRECTORY: value = paths.MSWGetShellDir(0x0019 | flags); break;
+            case Param_CSIDL_APPDATA:                 value = paths.MSWGetShellDir(0x001a | flags); break;
+            case Param_CSIDL_PRINTHOOD:               value = paths.MSWGetShellDir(0x001b | flags); break;
+            case Param_CSIDL_LOCAL_APPDATA:           value = paths.MSWGetShellDir(0x001c | flags); break;
+            case Param_CSIDL_ALTSTARTUP:              value = paths.MSWGetShellDir(0x001d | flags); break;
+            case Param_CSIDL_COMMON_ALTSTARTUP:       value = paths.MSWGetShellDir(0x001e | flags); break;
+            case Param_CSIDL_COMMON_FAVORITES:        value = paths.MSWGetShellDir(0x001f | flags); break;
+            case Param_CSIDL_INTERNET_CACHE:          value = paths.MSWGetShellDir(0x0020 | flags); break;
+            case Param_CSIDL_COOKIES:                 value = paths.MSWGetShellDir(0x0021 | flags); break;
+            case Param_CSIDL_HISTORY:                 value = paths.MSWGetShellDir(0x0022 | flags); break;
+            case Param_CSIDL_COMMON_APPDATA:          value = paths.MSWGetShellDir(0x0023 | flags); break;
+            case Param_CSIDL_WINDOWS:                 value = paths.MSWGetShellDir(0x0024 | flags); break;
+            case Param_CSIDL_SYSTEM:                  value = paths.MSWGetShellDir(0x0025 | flags); break;
+            case Param_CSIDL_PROGRAM_FILES:           value = paths.MSWGetShellDir(0x0026 | flags); break;
+            case Param_CSIDL_MYPICTURES:              value = paths.MSWGetShellDir(0x0027 | flags); break;
+            case Param_CSIDL_PROFILE:                 value = paths.MSWGetShellDir(0x0028 | flags); break;
+            case Param_CSIDL_SYSTEMX86:               value = paths.MSWGetShellDir(0x0029 | flags); break;
+            case Param_CSIDL_PROGRAM_FILESX86:        value = paths.MSWGetShellDir(0x002a | flags); break;
+            case Param_CSIDL_PROGRAM_FILES_COMMON:    value = paths.MSWGetShellDir(0x002b | flags); break;
+            case Param_CSIDL_PROGRAM_FILES_COMMONX86: value = paths.MSWGetShellDir(0x002c | flags); break;
+            case Param_CSIDL_COMMON_TEMPLATES:        value = paths.MSWGetShellDir(0x002d | flags); break;
+            case Param_CSIDL_COMMON_DOCUMENTS:        value = paths.MSWGetShellDir(0x002e | flags); break;
+            case Param_CSIDL_COMMON_ADMINTOOLS:       value = paths.MSWGetShellDir(0x002f | flags); break;
+            case Param_CSIDL_ADMINTOOLS:              value = paths.MSWGetShellDir(0x0030 | flags); break;
+            case Param_CSIDL_CONNECTIONS:             value = paths.MSWGetShellDir(0x0031 | flags); break;
+            case Param_CSIDL_COMMON_MUSIC:            value = paths.MSWGetShellDir(0x0035 | flags); break;
+            case Param_CSIDL_COMMON_PICTURES:         value = paths.MSWGetShellDir(0x0036 | flags); break;
+            case Param_CSIDL_COMMON_VIDEO:            value = paths.MSWGetShellDir(0x0037 | flags); break;
+            case Param_CSIDL_RESOURCES:               value = paths.MSWGetShellDir(0x0038 | flags); break;
+            case Param_CSIDL_RESOURCES_LOCALIZED:     value = paths.MSWGetShellDir(0x0039 | flags); break;
+            case Param_CSIDL_COMMON_OEM_LINKS:        value = paths.MSWGetShellDir(0x003a | flags); break;
+            case Param_CSIDL_COMPUTERSNEARME:         value = paths.MSWGetShellDir(0x003d | flags); break;
+#endif // #ifdef __WXMSW__
+
+#ifdef __WXGTK__
+            case Param_InstallPrefix:  value = paths.GetInstallPrefix(); break;
+#endif // #ifdef __WXGTK__
+
+            default:
+                wxFAIL;
+        }
+
+        SetStoredItem(i, Column_Value, value);
+        SetStoredItem(i, Column_Volume, GetVolumeDescription(value));
+    }
+}
+
+wxString StandardPathsView::GetVolumeDescription(const wxString& path)
+{
+#ifdef __LINUX__
+    // do not access the network, FUSE and automounted filesystems at all,
+    // even checking whether the path exists could block or trigger a mount
+    const LinuxMountInfo* pathMount = FindLinuxMount(m_mounts, path);
+
+    if ( pathMount && IsLinuxRemoteOrAutoFilesystem(pathMount->type) )
+        return wxString::Format(_("%s (%s)"), pathMount->mountPoint, pathMount->type);
+#endif // #ifdef __LINUX__
+
+    const wxString separator(wxFileName::GetPathSeparator());
+    wxString existingPath(path);
+
+    // the path may not exist (yet), e.g. UserDataDir, then use its nearest existing parent
+    while ( !existingPath.empty() && !wxFileName::Exists(existingPath) )
+    {
+        wxString parentPath = existingPath.BeforeLast(separator[0]);
+
+        if ( parentPath.empty() && existingPath.StartsWith(separator) )
+            parentPath = separator;
+
+        if ( parentPath == existingPath )
+            break;
+
+        existingPath = parentPath;
+    }
+
+    if ( existingPath.empty() )
+        return wxEmptyString;
+
+#ifdef __LINUX__
+    const LinuxMountInfo* mount = nullptr;
+    char* realPath = realpath(existingPath.fn_str(), nullptr);
+
+    if ( realPath )
+    {
+        mount = FindLinuxMount(m_mounts, wxString(realPath));
+        free(realPath);
+    }
+
+    // the path may be a symbolic link to such a filesystem
+    if ( mount && IsLinuxRemoteOrAutoFilesystem(mount->type) )
+        return wxString::Format(_("%s (%s)"), mount->mountPoint, mount->type);
+
+    // many of the paths are on the same volume
+    if ( mount )
+    {
+        const auto it = m_volumeDescriptions.find(mount->mountPoint);
+
+        if ( it != m_volumeDescriptions.end() )
+            return it->second;
+    }
+#endif // #ifdef __LINUX__
+
+    wxLongLong totalSpace, freeSpace;
+
+    if ( !wxGetDiskSpace(existingPath, &totalSpace, &freeSpace) )
+        return wxEmptyString;
+
+    wxString description = wxString::Format(_("%s free of %s"),
+        BytesToString(freeSpace.GetValue()), BytesToString(totalSpace.GetValue()));
+
+#ifdef __LINUX__
+    if ( mount )
+    {
+        description = wxString::Format(_("%s (%s), %s"), mount->mountPoint, mount->type, description);
+        m_volumeDescriptions[mount->mountPoint] = description;
+    }
+#endif // #ifdef __LINUX__
+
+    return description;
+}
+
+
+/*************************************************
+
+    EnvironmentVariablesView
+
+*************************************************/
+
+class EnvironmentVariablesView : public SysInfoListView
+{
+public:
+    EnvironmentVariablesView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    // the environment of a running application cannot be changed from outside
+    int GetVolatilities() const override { return Volatility_Constant; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+};
+
+EnvironmentVariablesView::EnvironmentVariablesView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void EnvironmentVariablesView::DoUpdateValues()
+{
+    DeleteAllStoredItems();
+
+    wxEnvVariableHashMap variables;
+
+    if ( !wxGetEnvMap(&variables) )
+    {
+        wxLogError(_("Could not retrieve system environment variables."));
+        return;
+    }
+
+    // sort variables alphabetically by name
+    std::map<wxString, wxString> variablesSorted;
+
+    for ( auto i = variables.begin(); i != variables.end(); ++i )
+        variablesSorted[i->first] = i->second;
+
+    for ( const auto& variable : variablesSorted )
+    {
+         const long itemIndex = AddStoredItem(variable.first);
+
+         if ( itemIndex != -1 )
+            SetStoredItem(itemIndex, Column_Value, variable.second);
+    }
+}
+
+
+/*************************************************
+
+    MiscellaneousView
+
+*************************************************/
+
+class ObtainFullHostNameThread;
+
+class MiscellaneousView : public SysInfoListView
+{
+public:
+    MiscellaneousView(wxWindow* parent);
+    ~MiscellaneousView();
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_All; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    enum
+    {
+        Param_AppName = 0,
+        Param_AppDisplayName,
+        Param_AppVendorName,
+        Param_AppVendorDisplayName,
+        Param_AppClassName,
+        Param_AppHasStderr,
+        Param_IsProcess64bit,
+        Param_wxRCEmbedded,
+        Param_UnixDesktopEnvironment,
+        Param_ThemeName,
+        Param_SystemAppearanceName,
+        Param_SystemAppearanceIsDark,
+        Param_SystemAppearanceIsSystemDark,
+        Param_SystemAppearanceAreAppsDark,
+        Param_ComCtl32Version,
+        Param_GDIObjectCount,
+        Param_UserObjectCount,
+        Param_IsProcessDPIAware,
+        Param_ProcessDPIAwareness,
+        Param_ThreadDPIAwarenessContext,
+        Param_ProcessSystemDPI,
+        Param_WindowDPI,
+        Param_WindowContentScaleFactor,
+        Param_PathSeparator,
+        Param_UserId,
+        Param_UserName,
+        Param_SystemEncodingName,
+        Param_SystemLanguage,
+#if wxCHECK_VERSION(3, 1, 6)
+        Param_UILocaleName,
+#endif
+        Param_HostName,
+        Param_FullHostName,
+        Param_OSDescription,
+        Param_OSVersion,
+        Param_LinuxDistributionInfo,
+        Param_OSDirectory,
+        Param_CPUArchitectureName,
+        Param_CPUCount,
+        Param_IsPlatform64Bit,
+        Param_IsPlatformLittleEndian,
+    };
+
+    ObtainFullHostNameThread* m_obtainFullHostNameThread{nullptr};
+
+    static Volatility GetParamVolatility(long param);
+
+    void OnObtainFullHostNameThread(wxThreadEvent& event);
+    // returns false when the lookup started by the previous update is still running
+    bool StartObtainFullHostNameThread();
+    void StopObtainFullHostNameThread();
+};
+
+#ifdef __WXMSW__
+
+class MSWDPIAwarenessHelper
+{
+public:
+    enum ProcessDPIAwareness
+    {
+        ProcessDPIUnaware         = 0,
+        ProcessSystemDPIAware     = 1,
+        ProcessPerMonitorDPIAware = 2,
+        ProcessDPINotApplicable   = 33333, // returned on error/unsupported
+    };
+
+    enum DPIAwarenessContext
+    {
+        DPIAwarenessContextUnaware           = -1,
+        DPIAwarenessContextSystemAware       = -2,
+        DPIAwarenessContextPerMonitorAware   = -3,
+        DPIAwarenessContextPerMonitorAwareV2 = -4,
+        DPIAwarenessContextUnawareGdiscaled  = -5,
+        DPIAwarenessContextNotApplicable     = -66666, // returned on error/unsupported
+    };
+
+    static bool IsThisProcessDPIAware();
+    static ProcessDPIAwareness GetThisProcessDPIAwareness();
+    static wxString GetThisProcessDPIAwarenessStr();
+    static unsigned GetSystemDpiForThisProcess();
+    static unsigned GetDpiForWindow(wxWindow* win);
+
+    static DPIAwarenessContext GetThreadDPIAwarenessContext();
+    static wxString GetThreadDPIAwarenessContextStr();
+};
+
+bool MSWDPIAwarenessHelper::IsThisProcessDPIAware()
+{
+    using IsProcessDPIAware_t = BOOL(WINAPI*)();
+
+    static bool s_initialised = false;
+    static IsProcessDPIAware_t s_pfnIsProcessDPIAware = nullptr;
+
+    if ( !s_initialised )
+    {
+        wxLoadedDLL dllUser32("user32.dll");
+
+        wxDL_INIT_FUNC(s_pfn, IsProcessDPIAware, dllUser32);
+        s_initialised = true;
+    }
+
+    if ( !s_pfnIsProcessDPIAware )
+        return false;
+
+    return s_pfnIsProcessDPIAware() == TRUE;
+}
+
+MSWDPIAwarenessHelper::ProcessDPIAwareness MSWDPIAwarenessHelper::GetThisProcessDPIAwareness()
+{
+    using GetProcessDpiAwareness_t = HRESULT(WINAPI*)(HANDLE, DWORD*);
+
+    static bool s_initialised = false;
+    static wxDynamicLibrary s_dllShcore;
+    static GetProcessDpiAwareness_t s_pfnGetProcessDpiAwareness = nullptr;
+
+    if ( !s_initialised )
+    {
+        if ( s_dllShcore.Load("shcore.dll", wxDL_VERBATIM | wxDL_QUIET) )
+        {
+            wxDL_INIT_FUNC(s_pfn, GetProcessDpiAwareness, s_dllShcore);
+
+            if ( !s_pfnGetProcessDpiAwareness )
+                s_dllShcore.Unload();
+        }
+
+        s_initialised = true;
+    }
+
+    if ( !s_pfnGetProcessDpiAwareness )
+        return ProcessDPINotApplicable;
+
+    DWORD value = ProcessDPINotApplicable;
+    const HRESULT hr = s_pfnGetProcessDpiAwareness(nullptr, &value);
+
+    if ( FAILED(hr) )
+    {
+        wxLogApiError("GetProcessDpiAwareness", hr);
+        return ProcessDPINotApplicable;
+    }
+
+    if ( value == ProcessDPIUnaware )
+        return ProcessDPIUnaware;
+    if ( value == ProcessSystemDPIAware )
+        return ProcessSystemDPIAware;
+    if ( value == ProcessPerMonitorDPIAware )
+        return ProcessPerMonitorDPIAware;
+
+    return ProcessDPINotApplicable;
+}
+
+wxString MSWDPIAwarenessHelper::GetThisProcessDPIAwarenessStr()
+{
+    const ProcessDPIAwareness awareness = GetThisProcessDPIAwareness();
+    wxString result;
+
+    switch ( awareness )
+    {
+        case ProcessDPIUnaware:
+            result = _("DPI Unaware");
+            break;
+        case ProcessSystemDPIAware:
+            result = _("System DPI Aware");
+            break;
+        case ProcessPerMonitorDPIAware:
+            result = _("Per Monitor DPI Aware");
+            break;
+        default:
+            result = _("<Not Applicable / Unknown>");
+    }
+
+    return result;
+}
+
+unsigned MSWDPIAwarenessHelper::GetSystemDpiForThisProcess()
+{
+    using GetSystemDpiForProcess_t = unsigned(WINAPI*)(HANDLE);
+
+    static bool s_initialised = false;
+    static GetSystemDpiForProcess_t s_pfnGetSystemDpiForProcess = nullptr;
+
+    if ( !s_initialised )
+    {
+        wxLoadedDLL dllUser32("user32.dll");
+
+        wxDL_INIT_FUNC(s_pfn, GetSystemDpiForProcess, dllUser32);
+        s_initialised = true;
+    }
+
+    if ( !s_pfnGetSystemDpiForProcess )
+        return 96;
+
+    return s_pfnGetSystemDpiForProcess(nullptr);
+}
+
+unsigned MSWDPIAwarenessHelper::GetDpiForWindow(wxWindow* win)
+{
+    using GetDpiForWindow_t = unsigned (WINAPI*)(HWND);
+
+    static bool s_initialised = false;
+    static GetDpiForWindow_t s_pfnGetDpiForWindow = nullptr;
+
+    if ( !s_initialised )
+    {
+        wxLoadedDLL dllUser32("user32.dll");
+
+        wxDL_INIT_FUNC(s_pfn, GetDpiForWindow, dllUser32);
+        s_initialised = true;
+    }
+
+    if ( !s_pfnGetDpiForWindow )
+        return 96;
+
+    return s_pfnGetDpiForWindow(win->GetHWND());
+}
+
+MSWDPIAwarenessHelper::DPIAwarenessContext MSWDPIAwarenessHelper::GetThreadDPIAwarenessContext()
+{
+    using MSW_DPI_AWARENESS_CONTEXT = HANDLE;
+    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_UNAWARE              = (MSW_DPI_AWARENESS_CONTEXT)-1;
+    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_SYSTEM_AWARE         = (MSW_DPI_AWARENESS_CONTEXT)-2;
+    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE    = (MSW_DPI_AWARENESS_CONTEXT)-3;
+    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2 = (MSW_DPI_AWARENESS_CONTEXT)-4;
+    static const MSW_DPI_AWARENESS_CONTEXT MSW_DPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED    = (MSW_DPI_AWARENESS_CONTEXT)-5;
+
+    using GetThreadDpiAwarenessContext_t = MSW_DPI_AWARENESS_CONTEXT(WINAPI*)();
+    using IsValidDpiAwarenessContext_t   = BOOL(WINAPI*)(MSW_DPI_AWARENESS_CONTEXT);
+    using AreDpiAwarenessContextsEqual_t = BOOL(WINAPI*)(MSW_DPI_AWARENESS_CONTEXT, MSW_DPI_AWARENESS_CONTEXT);
+
+    static bool s_initialised = false;
+    static GetThreadDpiAwarenessContext_t s_pfnGetThreadDpiAwarenessContext = nullptr;
+    static IsValidDpiAwarenessContext_t   s_pfnIsValidDpiAwarenessContext   = nullptr;
+    static AreDpiAwarenessContextsEqual_t s_pfnAreDpiAwarenessContextsEqual = nullptr;
+
+    if ( !s_initialised )
+    {
+        wxLoadedDLL dllUser32("user32.dll");
+
+        wxDL_INIT_FUNC(s_pfn, GetThreadDpiAwarenessContext, dllUser32);
+        wxDL_INIT_FUNC(s_pfn, AreDpiAwarenessContextsEqual, dllUser32);
+        wxDL_INIT_FUNC(s_pfn, IsValidDpiAwarenessContext, dllUser32);
+        s_initialised = true;
+    }
+
+    if ( !s_pfnGetThreadDpiAwarenessContext
+         || !s_pfnAreDpiAwarenessContextsEqual
+         || !s_pfnIsValidDpiAwarenessContext )
+    {
+        return DPIAwarenessContextNotApplicable;
+    }
+
+    const MSW_DPI_AWARENESS_CONTEXT value = s_pfnGetThreadDpiAwarenessContext();
+
+    if ( !s_pfnIsValidDpiAwarenessContext(value) )
+        return DPIAwarenessContextUnaware;
+
+    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_UNAWARE) )
+        return DPIAwarenessContextUnaware;
+    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_SYSTEM_AWARE) )
+        return DPIAwarenessContextSystemAware;
+    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE) )
+        return DPIAwarenessContextPerMonitorAware;
+    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2) )
+        return DPIAwarenessContextPerMonitorAwareV2;
+    if ( s_pfnAreDpiAwarenessContextsEqual(value, MSW_DPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED) )
+        return DPIAwarenessContextUnawareGdiscaled;
+
+    return DPIAwarenessContextNotApplicable;
+}
+
+wxString MSWDPIAwarenessHelper::GetThreadDPIAwarenessContextStr()
+{
+    const DPIAwarenessContext context = GetThreadDPIAwarenessContext();
+    wxString result;
+
+    switch ( context )
+    {
+        case DPIAwarenessContextUnaware:
+            result = _("DPI Unaware");
+            break;
+        case DPIAwarenessContextSystemAware:
+            result = _("System DPI Aware");
+            break;
+        case DPIAwarenessContextPerMonitorAware:
+            result = _("Per Monitor DPI Aware");
+            break;
+        case DPIAwarenessContextPerMonitorAwareV2:
+            result = _("Per Monitor DPI Aware V2");
+            break;
+        case DPIAwarenessContextUnawareGdiscaled:
+            result = _("DPI Unaware GDI Scaled");
+            break;
+        default:
+            result = _("<Not Applicable / Unknown>");
+    }
+
+    return result;
+}
+
+#endif // #ifdef __WXMSW__
+
+class ObtainFullHostNameThread : public wxThread
+{
+public:
+    ObtainFullHostNameThread(wxEvtHandler* sink)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_sink(sink)
+    {}
+
+protected:
+    wxEvtHandler* m_sink;
+
+    ExitCode Entry() override
+    {
+        wxThreadEvent evt;
+
+        evt.SetString(wxGetFullHostName());
+        wxQueueEvent(m_sink, evt.Clone());
+        return static_cast<wxThread::ExitCode>(nullptr);
+    }
+};
+
+#ifdef __WXGTK__
+wxString s_GTKThemeName;
+#endif // #ifdef __WXGTK__
+
+wxString GetThemeName()
+{
+    wxString name = "<Unsupported on This Platform>";
+
+#ifdef __WXMSW__
+    static const int buffSize = 1024;
+
+    WCHAR fileName[buffSize+1]{0};
+    WCHAR colorName[buffSize+1]{0};
+    WCHAR displayName[buffSize+1]{0};
+
+    if ( SUCCEEDED(::GetCurrentThemeName(fileName, buffSize, colorName, buffSize, nullptr, 0)) )
+    {
+        if ( SUCCEEDED(::GetThemeDocumentationProperty(fileName, SZ_THDOCPROP_DISPLAYNAME, displayName, buffSize)) )
+        {
+            HIGHCONTRAST hc{0};
+
+            name.Printf("%s / %s", displayName, colorName);
+
+            hc.cbSize = sizeof(hc);
+            if ( ::SystemParametersInfo(SPI_GETHIGHCONTRAST, sizeof(hc), &hc, 0) )
+            {
+                if ( (hc.dwFlags & HCF_HIGHCONTRASTON) == HCF_HIGHCONTRASTON )
+                    name += _(" (High Contrast)");
+            }
+        }
+    }
+#endif
+
+#ifdef __WXGTK__
+    // the cache is cleared when wxSystemInformationFrame is notified about the theme change
+    if ( s_GTKThemeName.empty() )
+    {
+        GtkSettings* settings = gtk_settings_get_default();
+        gchar* themeName = nullptr;
+
+        g_object_get(settings, "gtk-theme-name", &themeName, nullptr);
+        s_GTKThemeName = wxString::FromUTF8(themeName);
+        g_free(themeName);
+    }
+
+    name = s_GTKThemeName;
+#endif
+
+    return name;
+}
+
+MiscellaneousView::~MiscellaneousView()
+{
+    StopObtainFullHostNameThread();
+}
+
+MiscellaneousView::MiscellaneousView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    AppendItemWithData(_("App Name"), Param_AppName);
+    AppendItemWithData(_("App Display Name"), Param_AppDisplayName);
+    AppendItemWithData(_("App Vendor Name"), Param_AppVendorName);
+    AppendItemWithData(_("App Vendor Display Name"), Param_AppVendorDisplayName);
+    AppendItemWithData(_("App Class Name"), Param_AppClassName);
+    AppendItemWithData(_("App HasStderr"), Param_AppHasStderr);
+    AppendItemWithData(_("64-bit Process"), Param_IsProcess64bit);
+#ifdef __WXMSW__
+    AppendItemWithData(_("Is <wx/wx.rc> Embedded"), Param_wxRCEmbedded);
+#endif // #ifdef __WXMSW__
+#ifdef __UNIX__
+    AppendItemWithData(_("Unix Desktop Environment"), Param_UnixDesktopEnvironment);
+#endif // #ifdef __UNIX__
+    AppendItemWithData(_("Theme Name"), Param_ThemeName);
+#if wxCHECK_VERSION(3, 1, 3)
+    AppendItemWithData(_("System Appearance Name"), Param_SystemAppearanceName);
+    AppendItemWithData(_("System Appearance IsDark"), Param_SystemAppearanceIsDark);
+#endif
+
+#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+    AppendItemWithData(_("System Appearance IsSystemDark"), Param_SystemAppearanceIsSystemDark);
+    AppendItemWithData(_("System Appearance AreAppsDark"), Param_SystemAppearanceAreAppsDark);
+#endif //#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+
+#ifdef __WXMSW__
+    AppendItemWithData(_("ComCtl32.dll Version"), Param_ComCtl32Version);
+    AppendItemWithData(_("GDI Object Count"), Param_GDIObjectCount);
+    AppendItemWithData(_("User Object Count"), Param_UserObjectCount);
+    AppendItemWithData(_("Is Process DPI Aware"), Param_IsProcessDPIAware);
+    AppendItemWithData(_("Process DPI Awareness"), Param_ProcessDPIAwareness);
+    AppendItemWithData(_("Thread DPI Awareness Context"), Param_ThreadDPIAwarenessContext);
+    AppendItemWithData(_("System DPI for Process"), Param_ProcessSystemDPI);
+    AppendItemWithData(_("DPI for This Window"), Param_WindowDPI);
+#endif // #ifdef __WXMSW__
+
+    AppendItemWithData(_("Window Content Scale Factor"), Param_WindowContentScaleFactor);
+    AppendItemWithData(_("Path Separator"), Param_PathSeparator);
+    AppendItemWithData(_("User Id"), Param_UserId);
+    AppendItemWithData(_("User Name"), Param_UserName);
+    AppendItemWithData(_("System Encoding"), Param_SystemEncodingName);
+    AppendItemWithData(_("System Language"), Param_SystemLanguage);
+#if wxCHECK_VERSION(3, 1, 6)
+    AppendItemWithData(_("UI Locale Name"), Param_UILocaleName);
+#endif
+    AppendItemWithData(_("Host Name"), Param_HostName);
+    AppendItemWithData(_("Full Host Name"), Param_FullHostName);
+    AppendItemWithData(_("OS Description"), Param_OSDescription);
+    AppendItemWithData(_("OS Version"), Param_OSVersion);
+#ifdef __LINUX__
+    AppendItemWithData(_("Linux Distribution Info"), Param_LinuxDistributionInfo);
+#endif // #ifdef __LINUX__
+    AppendItemWithData(_("OS Directory"), Param_OSDirectory);
+#if wxCHECK_VERSION(3, 1, 5)
+    AppendItemWithData(_("CPU Architecture Name"), Param_CPUArchitectureName);
+#endif
+    AppendItemWithData(_("64-bit Platform"), Param_IsPlatform64Bit);
+    AppendItemWithData(_("CPU Count"), Param_CPUCount);
+    AppendItemWithData(_("Little Endian"), Param_IsPlatformLittleEndian);
+
+    Bind(wxEVT_THREAD, &MiscellaneousView::OnObtainFullHostNameThread, this);
+
+    UpdateValues();
+}
+
+MiscellaneousView::Volatility MiscellaneousView::GetParamVolatility(long param)
+{
+    switch ( param )
+    {
+        case Param_AppClassName:
+        case Param_AppHasStderr:
+        case Param_IsProcess64bit:
+        case Param_wxRCEmbedded:
+        case Param_UnixDesktopEnvironment:
+        case Param_ComCtl32Version:
+        case Param_PathSeparator:
+        case Param_UserId:
+        case Param_UserName:
+        case Param_SystemEncodingName:
+        case Param_SystemLanguage:
+        case Param_OSDescription:
+        case Param_OSVersion:
+        case Param_LinuxDistributionInfo:
+        case Param_OSDirectory:
+        case Param_CPUArchitectureName:
+        case Param_IsPlatform64Bit:
+        case Param_IsPlatformLittleEndian:
+            return Volatility_Constant;
+
+        case Param_GDIObjectCount:
+        case Param_UserObjectCount:
+        case Param_CPUCount:
+            return Volatility_Live;
+
+        default:
+            return Volatility_OnEvent;
+    }
+}
+
+void MiscellaneousView::DoUpdateValues()
+{
+    int verMajor = 0, verMinor = 0, verMicro = 0;
+    wxAppConsole* appInstance = wxAppConsole::GetInstance();
+    wxAppTraits* appTraits = appInstance->GetTraits();
+    const long itemCount = GetStoredItemCount();
+#ifdef __WXMSW__
+    HANDLE hCurrentProcess = ::GetCurrentProcess();
+    const DWORD GDIObjectCount = ::GetGuiResources(hCurrentProcess, GR_GDIOBJECTS);
+    const DWORD UserObjectCount =  ::GetGuiResources(hCurrentProcess, GR_USEROBJECTS);
+    bool wxRCEmbedded = false;
+#endif
+#ifdef __LINUX__
+    wxLinuxDistributionInfo linuxDistributionInfo;
+#endif // #ifdef __LINUX__
+
+#if wxCHECK_VERSION(3, 1, 3)
+    const wxSystemAppearance systemAppearance = wxSystemSettings::GetAppearance();
+#endif
+
+    // obtaining some of the constant values is expensive, e.g.,
+    // wxGetLinuxDistributionInfo() runs an external program
+    if ( IsUpdatingVolatility(Volatility_Constant) )
+    {
+#ifdef __WXMSW__
+        wxLogNull logNo;
+
+        wxRCEmbedded = wxBitmap("wxBITMAP_STD_COLOURS").IsOk();
+#endif // #ifdef __WXMSW__
+#ifdef __LINUX__
+        linuxDistributionInfo = wxGetLinuxDistributionInfo();
+#endif // #ifdef __LINUX__
+
+        wxGetOsVersion(&verMajor, &verMinor, &verMicro);
+    }
+
+    // the host names change rarely and the lookup can take long
+    const bool obtainingFullHostName = IsUpdatingVolatility(GetParamVolatility(Param_FullHostName))
+                                       && StartObtainFullHostNameThread();
+
+    for ( int i = 0; i < itemCount; ++i )
+    {
+        const long param = GetStoredItemData(i);
+        wxString value;
+
+        if ( !IsUpdatingVolatility(GetParamVolatility(param)) )
+            continue;
+
+        switch ( param )
+        {
+            case Param_AppName:                   value = appInstance->GetAppName(); break;
+            case Param_AppDisplayName:            value = appInstance->GetAppDisplayName(); break;
+            case Param_AppVendorName:             value = appInstance->GetVendorName(); break;
+            case Param_AppVendorDisplayName:      value = appInstance->GetVendorDisplayName(); break;
+            case Param_AppClassName:              value = appInstance->GetClassName(); break;
+            case Param_AppHasStderr:              value = appTraits->HasStderr() ? _("Yes") : _("No"); break;
+            case Param_IsProcess64bit:            value = sizeof(void*) == 8 ? _("Yes") : _("No"); break;
+#ifdef __WXMSW__
+            case Param_wxRCEmbedded:              value = wxRCEmbedded ? _("Yes") : _("No"); break;
+#endif // #ifdef __WXMSW__
+#ifdef __UNIX__
+            case Param_UnixDesktopEnvironment:    value = appTraits->GetDesktopEnvironment(); break;
+#endif // #ifdef __UNIX__
+
+            case Param_ThemeName:                 value = GetThemeName(); break;
+#if wxCHECK_VERSION(3, 1, 3)
+            case Param_SystemAppearanceName:      value = systemAppearance.GetName(); break;
+            case Param_SystemAppearanceIsDark:    value = systemAppearance.IsDark() ? _("Yes") : _("No"); break;
+#endif
+
+#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+            case Param_SystemAppearanceIsSystemDark: value = systemAppearance.IsSystemDark() ? _("Yes") : _("No"); break;
+            case Param_SystemAppearanceAreAppsDark:  value = systemAppearance.AreAppsDark() ? _("Yes") : _("No"); break;
+#endif //#if defined(__WXMSW__) && wxCHECK_VERSION(3, 3, 0)
+
+#ifdef __WXMSW__
+            case Param_ComCtl32Version:           value.Printf("%d", wxApp::GetComCtl32Version()); break;
+            case Param_GDIObjectCount:            value = GDIObjectCount ? wxString::Format("%lu", GDIObjectCount) : _("N/A"); break;
+            case Param_UserObjectCount:           value = UserObjectCount ? wxString::Format("%lu", UserObjectCount) : _("N/A"); break;
+            case Param_IsProcessDPIAware:         value = MSWDPIAwarenessHelper::IsThisProcessDPIAware() ? _("Yes") : _("No"); break;
+            case Param_ProcessDPIAwareness:       value = MSWDPIAwarenessHelper::GetThisProcessDPIAwarenessStr(); break;
+            case Param_ThreadDPIAwarenessContext: value = MSWDPIAwarenessHelper::GetThreadDPIAwarenessContextStr(); break;
+            case Param_ProcessSystemDPI:          value.Printf("%d", MSWDPIAwarenessHelper::GetSystemDpiForThisProcess()); break;
+            case Param_WindowDPI:                 value.Printf("%d", MSWDPIAwarenessHelper::GetDpiForWindow(this)); break;
+#endif // #ifdef __WXMSW__
+
+            case Param_WindowContentScaleFactor:  value.Printf("%.2f", GetContentScaleFactor()); break;
+            case Param_PathSeparator:             value.Printf("%s", wxString(wxFileName::GetPathSeparator())); break;
+            case Param_UserId:                    value = wxGetUserId(); break;
+            case Param_UserName:                  value = wxGetUserName(); break;
+            case Param_SystemEncodingName:        value = wxLocale::GetSystemEncodingName(); break;
+            case Param_SystemLanguage:            value =  wxLocale::GetLanguageName(wxLocale::GetSystemLanguage()); break;
+#if wxCHECK_VERSION(3, 1, 6)
+            case Param_UILocaleName:              value =  wxUILocale::GetCurrent().GetName(); break;
+#endif
+            case Param_HostName:                  value = wxGetHostName(); break;
+            case Param_FullHostName:
+                // the running lookup will set the value
+                if ( !obtainingFullHostName )
+                    continue;
+                value = _("<Evaluating...>");
+                break;
+            case Param_OSDescription:             value =  wxGetOsDescription(); break;
+            case Param_OSVersion:                 value.Printf(_("%d.%d.%d"), verMajor, verMinor, verMicro); break;
+#ifdef __LINUX__
+            case Param_LinuxDistributionInfo:     value.Printf("%s (%s)", linuxDistributionInfo.Description, linuxDistributionInfo.CodeName); break;
+#endif // #ifdef __LINUX__
+            case Param_OSDirectory:               value = wxGetOSDirectory(); break;
+#if wxCHECK_VERSION(3, 1, 5)
+            case  Param_CPUArchitectureName:      value = wxGetCpuArchitectureName(); break;
+#endif
+            case Param_IsPlatform64Bit:           value = wxIsPlatform64Bit() ? _("Yes") : _("No"); break;
+            case Param_CPUCount:                  value.Printf("%d", wxThread::GetCPUCount()); break;
+            case Param_IsPlatformLittleEndian:    value =  wxIsPlatformLittleEndian() ? _("Yes") : _("No"); break;
+
+            default:
+                wxFAIL;
+        }
+
+        SetStoredItem(i, Column_Value, value);
+    }
+}
+
+void MiscellaneousView::OnObtainFullHostNameThread(wxThreadEvent& event)
+{
+    const long itemIndex = FindStoredItem(-1, Param_FullHostName);
+
+    if ( itemIndex != wxNOT_FOUND )
+        SetStoredItem(itemIndex, Column_Value, event.GetString());
+}
+
+bool MiscellaneousView::StartObtainFullHostNameThread()
+{
+    if ( m_obtainFullHostNameThread && m_obtainFullHostNameThread->IsRunning() )
+        return false;
+
+    StopObtainFullHostNameThread();
+
+    m_obtainFullHostNameThread = new ObtainFullHostNameThread(this);
+    if ( m_obtainFullHostNameThread->Run() != wxTHREAD_NO_ERROR )
+    {
+        delete m_obtainFullHostNameThread;
+        m_obtainFullHostNameThread= nullptr;
+        wxLogError(_("Could not create the thread needed to obtain the full host name."));
+    }
+
+    return true;
+}
+
+void MiscellaneousView::StopObtainFullHostNameThread()
+{
+    if ( m_obtainFullHostNameThread )
+    {
+        m_obtainFullHostNameThread->Delete();
+        delete m_obtainFullHostNameThread;
+        m_obtainFullHostNameThread = nullptr;
+    }
+}
+
+/*************************************************
+
+    PreprocessorDefinesView
+
+*************************************************/
+
+class PreprocessorDefinesView : public SysInfoListView
+{
+public:
+    PreprocessorDefinesView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    // preprocessor defines cannot be changed when the application is running
+    int GetVolatilities() const override { return Volatility_Constant; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+};
+
+PreprocessorDefinesView::PreprocessorDefinesView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+wxString DefineValueToText(const wxString& name, const wxString& value)
+{
+    if ( name == value )
+        return _("<Is Not Defined>");
+
+    if ( value.empty() )
+        return _("<Is Defined>");
+
+    return value;
+}
+
+#define APPEND_DEFINE_ITEM(value) \
+    itemIndex = AddStoredItem(#value); \
+    SetStoredItem(itemIndex, Column_Value, DefineValueToText(#value, wxSTRINGIZE_T(value)));
+
+#define APPEND_HAS_FEATURE_ITEM(name, value) \
+    itemIndex = AddStoredItem(name); \
+    SetStoredItem(itemIndex, Column_Value, hasDefine ? _("Yes") : _("No")); \
+    hasDefine = false;
+
+void PreprocessorDefinesView::DoUpdateValues()
+{
+    long itemIndex;
+
+    APPEND_DEFINE_ITEM(__cplusplus)
+
+#ifdef _MSC_VER
+    APPEND_DEFINE_ITEM(_MSC_VER)
+    APPEND_DEFINE_ITEM(_MSC_FULL_VER)
+    APPEND_DEFINE_ITEM(_MSVC_LANG)
+    APPEND_DEFINE_ITEM(_DEBUG)
+    APPEND_DEFINE_ITEM(_DLL)
+#endif // #ifdef _MSC_VER
+
+#ifdef __GNUC__
+    APPEND_DEFINE_ITEM(__GNUC__)
+    APPEND_DEFINE_ITEM(__GNUC_MINOR__)
+    APPEND_DEFINE_ITEM(__GNUC_PATCHLEVEL__)
+#endif // #ifdef(__GNUC__)
+
+#ifdef __MINGW32__
+    APPEND_DEFINE_ITEM(__MINGW32__)
+    APPEND_DEFINE_ITEM(__MINGW32_MAJOR_VERSION)
+    APPEND_DEFINE_ITEM(__MINGW32_MINOR_VERSION)
+#endif
+
+#ifdef __MINGW64__
+    APPEND_DEFINE_ITEM(__MINGW64__)
+    APPEND_DEFINE_ITEM(__MINGW64_VERSION_MAJOR)
+    APPEND_DEFINE_ITEM(__MINGW64_VERSION_MINOR)
+#endif
+
+#ifdef __MINGW32_TOOLCHAIN__
+    APPEND_DEFINE_ITEM(__MINGW32_TOOLCHAIN__)
+#endif
+
+#ifdef __MINGW64_TOOLCHAIN__
+    APPEND_DEFINE_ITEM(__MINGW64_TOOLCHAIN__)
+#endif
+
+#ifdef __clang__
+    APPEND_DEFINE_ITEM(__clang__)
+    APPEND_DEFINE_ITEM(__clang_major__)
+    APPEND_DEFINE_ITEM(__clang_minor__)
+    APPEND_DEFINE_ITEM(__clang_patchlevel__)
+#endif
+
+#ifdef __CYGWIN__
+    APPEND_DEFINE_ITEM(__CYGWIN__)
+#endif
+
+    APPEND_DEFINE_ITEM(NDEBUG)
+
+#ifdef __WXGTK__
+    APPEND_DEFINE_ITEM(__WXGTK3__)
+#endif
+
+#ifdef __WXMSW__
+    APPEND_DEFINE_ITEM(_UNICODE)
+    APPEND_DEFINE_ITEM(WXUSINGDLL)
+#endif
+
+    const long ABIVersion = wxABI_VERSION;
+    itemIndex = AddStoredItem("wxABI_VERSION");
+    SetStoredItem(itemIndex, Column_Value, wxString::Format("%ld", ABIVersion));
+
+#ifdef WXWIN_COMPATIBILITY_2_8
+    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_2_8)
+#endif
+#ifdef WXWIN_COMPATIBILITY_3_0
+    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_3_0)
+#endif
+#ifdef WXWIN_COMPATIBILITY_3_2
+    APPEND_DEFINE_ITEM(WXWIN_COMPATIBILITY_3_2)
+#endif
+
+    itemIndex = AddStoredItem("WX_BUILD_OPTIONS_SIGNATURE");
+    SetStoredItem(itemIndex, Column_Value, WX_BUILD_OPTIONS_SIGNATURE);
+
+    APPEND_DEFINE_ITEM(wxUSE_REPRODUCIBLE_BUILD)
+    APPEND_DEFINE_ITEM(wxDEBUG_LEVEL)
+    APPEND_DEFINE_ITEM(wxUSE_ON_FATAL_EXCEPTION)
+    APPEND_DEFINE_ITEM(wxUSE_STACKWALKER)
+    APPEND_DEFINE_ITEM(wxUSE_DEBUGREPORT)
+    APPEND_DEFINE_ITEM(wxUSE_DEBUG_CONTEXT)
+    APPEND_DEFINE_ITEM(wxUSE_MEMORY_TRACING)
+    APPEND_DEFINE_ITEM(wxUSE_GLOBAL_MEMORY_OPERATORS)
+    APPEND_DEFINE_ITEM(wxUSE_DEBUG_NEW_ALWAYS)
+#ifdef _MSC_VER
+    APPEND_DEFINE_ITEM(wxUSE_VC_CRTDBG)
+#endif // #ifdef _MSC_VER
+#ifdef __WXMSW__
+    APPEND_DEFINE_ITEM(wxUSE_NO_MANIFEST)
+    #if !defined(wxUSE_NO_MANIFEST) || (wxUSE_NO_MANIFEST == 0)
+        APPEND_DEFINE_ITEM(wxUSE_RC_MANIFEST)
+    #endif //#if !defined(wxUSE_NO_MANIFEST) || (wxUSE_NO_MANIFEST == 0)
+    #if defined(wxUSE_RC_MANIFEST) && wxUSE_RC_MANIFEST
+        APPEND_DEFINE_ITEM(wxUSE_DPI_AWARE_MANIFEST)
+    #endif // #if defined(wxUSE_RC_MANIFEST) && wxUSE_RC_MANIFEST
+#endif // #ifdef __WXMSW__
+    APPEND_DEFINE_ITEM(wxUSE_UNICODE)
+    APPEND_DEFINE_ITEM(wxUSE_UNICODE_WCHAR)
+    APPEND_DEFINE_ITEM(wxUSE_UNICODE_UTF8)
+    APPEND_DEFINE_ITEM(wxUSE_UTF8_LOCALE_ONLY)
+    APPEND_DEFINE_ITEM(wxUSE_UNSAFE_WXSTRING_CONV)
+    APPEND_DEFINE_ITEM(wxNO_UNSAFE_WXSTRING_CONV)
+    APPEND_DEFINE_ITEM(wxNO_IMPLICIT_WXSTRING_ENCODING)
+    APPEND_DEFINE_ITEM(wxUSE_EXCEPTIONS)
+    APPEND_DEFINE_ITEM(wxUSE_EXTENDED_RTTI)
+    APPEND_DEFINE_ITEM(wxUSE_LOG)
+    APPEND_DEFINE_ITEM(wxUSE_LOGWINDOW)
+    APPEND_DEFINE_ITEM(wxUSE_LOGGUI)
+    APPEND_DEFINE_ITEM(wxUSE_LOG_DIALOG)
+    APPEND_DEFINE_ITEM(wxUSE_CMDLINE_PARSER)
+    APPEND_DEFINE_ITEM(wxUSE_THREADS)
+    APPEND_DEFINE_ITEM(wxUSE_STREAMS)
+    APPEND_DEFINE_ITEM(wxUSE_PRINTF_POS_PARAMS)
+    APPEND_DEFINE_ITEM(wxUSE_COMPILER_TLS)
+    APPEND_DEFINE_ITEM(wxUSE_STL)
+    APPEND_DEFINE_ITEM(wxUSE_STD_DEFAULT)
+    APPEND_DEFINE_ITEM(wxUSE_STD_CONTAINERS_COMPATIBLY)
+    APPEND_DEFINE_ITEM(wxUSE_STD_CONTAINERS)
+    APPEND_DEFINE_ITEM(wxUSE_STD_IOSTREAM)
+    APPEND_DEFINE_ITEM(wxUSE_STD_STRING)
+    APPEND_DEFINE_ITEM(wxUSE_STD_STRING_CONV_IN_WXSTRING)
+    APPEND_DEFINE_ITEM(wxUSE_LONGLONG)
+    APPEND_DEFINE_ITEM(wxUSE_BASE64)
+    APPEND_DEFINE_ITEM(wxUSE_CONSOLE_EVENTLOOP)
+    APPEND_DEFINE_ITEM(wxUSE_FILE)
+    APPEND_DEFINE_ITEM(wxUSE_FFILE)
+    APPEND_DEFINE_ITEM(wxUSE_FSVOLUME)
+    APPEND_DEFINE_ITEM(wxUSE_SECRETSTORE)
+    APPEND_DEFINE_ITEM(wxUSE_STDPATHS)
+    APPEND_DEFINE_ITEM(wxUSE_TEXTBUFFER)
+    APPEND_DEFINE_ITEM(wxUSE_TEXTFILE)
+    APPEND_DEFINE_ITEM(wxUSE_INTL)
+    APPEND_DEFINE_ITEM(wxUSE_XLOCALE)
+    APPEND_DEFINE_ITEM(wxUSE_DATETIME)
+    APPEND_DEFINE_ITEM(wxUSE_TIMER)
+    APPEND_DEFINE_ITEM(wxUSE_STOPWATCH)
+    APPEND_DEFINE_ITEM(wxUSE_FSWATCHER)
+    APPEND_DEFINE_ITEM(wxUSE_CONFIG)
+    APPEND_DEFINE_ITEM(wxUSE_CONFIG_NATIVE)
+    APPEND_DEFINE_ITEM(wxUSE_DIALUP_MANAGER)
+    APPEND_DEFINE_ITEM(wxUSE_DYNLIB_CLASS)
+    APPEND_DEFINE_ITEM(wxUSE_DYNAMIC_LOADER)
+    APPEND_DEFINE_ITEM(wxUSE_SOCKETS)
+    APPEND_DEFINE_ITEM(wxUSE_IPV6)
+    APPEND_DEFINE_ITEM(wxUSE_FILESYSTEM)
+    APPEND_DEFINE_ITEM(wxUSE_FS_ZIP)
+    APPEND_DEFINE_ITEM(wxUSE_FS_ARCHIVE)
+    APPEND_DEFINE_ITEM(wxUSE_FS_INET)
+    APPEND_DEFINE_ITEM(wxUSE_ARCHIVE_STREAMS)
+    APPEND_DEFINE_ITEM(wxUSE_ZIPSTREAM)
+    APPEND_DEFINE_ITEM(wxUSE_TARSTREAM)
+    APPEND_DEFINE_ITEM(wxUSE_ZLIB)
+    APPEND_DEFINE_ITEM(wxUSE_LIBLZMA)
+    APPEND_DEFINE_ITEM(wxUSE_APPLE_IEEE)
+    APPEND_DEFINE_ITEM(wxUSE_JOYSTICK)
+    APPEND_DEFINE_ITEM(wxUSE_FONTENUM)
+    APPEND_DEFINE_ITEM(wxUSE_FONTMAP)
+    APPEND_DEFINE_ITEM(wxUSE_MIMETYPE)
+    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL)
+    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_FILE)
+    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_FTP)
+    APPEND_DEFINE_ITEM(wxUSE_PROTOCOL_HTTP)
+    APPEND_DEFINE_ITEM(wxUSE_URL)
+    APPEND_DEFINE_ITEM(wxUSE_URL_NATIVE)
+    APPEND_DEFINE_ITEM(wxUSE_VARIANT)
+    APPEND_DEFINE_ITEM(wxUSE_ANY)
+    APPEND_DEFINE_ITEM(wxUSE_REGEX)
+    APPEND_DEFINE_ITEM(wxUSE_SYSTEM_OPTIONS)
+    APPEND_DEFINE_ITEM(wxUSE_SOUND)
+    APPEND_DEFINE_ITEM(wxUSE_MEDIACTRL)
+    APPEND_DEFINE_ITEM(wxUSE_XRC)
+    APPEND_DEFINE_ITEM(wxUSE_XML)
+    APPEND_DEFINE_ITEM(wxUSE_AUI)
+    APPEND_DEFINE_ITEM(wxUSE_RIBBON)
+    APPEND_DEFINE_ITEM(wxUSE_PROPGRID)
+    APPEND_DEFINE_ITEM(wxUSE_STC)
+    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW)
+#ifdef __WXMSW__
+    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_IE)
+    #ifdef wxUSE_WEBVIEW_EDGE
+        APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_EDGE)
+    #endif
+    #ifdef wxUSE_WEBVIEW_EDGE_STATIC
+        APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_EDGE_STATIC)
+    #endif
+#else
+    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_WEBKIT)
+#endif // #else
+#ifdef __WXGTK__
+    APPEND_DEFINE_ITEM(wxUSE_WEBVIEW_WEBKIT2)
+#endif // #ifdef __WXGTK__
+
+    APPEND_DEFINE_ITEM(wxUSE_GRAPHICS_CONTEXT)
+    APPEND_DEFINE_ITEM(wxUSE_CAIRO)
+    APPEND_DEFINE_ITEM(wxUSE_CONTROLS)
+    APPEND_DEFINE_ITEM(wxUSE_MARKUP)
+    APPEND_DEFINE_ITEM(wxUSE_POPUPWIN)
+    APPEND_DEFINE_ITEM(wxUSE_TIPWINDOW)
+    APPEND_DEFINE_ITEM(wxUSE_ACTIVITYINDICATOR)
+    APPEND_DEFINE_ITEM(wxUSE_ANIMATIONCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_BANNERWINDOW)
+    APPEND_DEFINE_ITEM(wxUSE_BUTTON)
+    APPEND_DEFINE_ITEM(wxUSE_BMPBUTTON)
+    APPEND_DEFINE_ITEM(wxUSE_CALENDARCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_CHECKBOX)
+    APPEND_DEFINE_ITEM(wxUSE_CHOICE)
+    APPEND_DEFINE_ITEM(wxUSE_COLLPANE)
+    APPEND_DEFINE_ITEM(wxUSE_COLOURPICKERCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_COMBOBOX)
+    APPEND_DEFINE_ITEM(wxUSE_COMMANDLINKBUTTON)
+    APPEND_DEFINE_ITEM(wxUSE_DATAVIEWCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_DATEPICKCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_DIRPICKERCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_EDITABLELISTBOX)
+    APPEND_DEFINE_ITEM(wxUSE_FILECTRL)
+    APPEND_DEFINE_ITEM(wxUSE_FILEPICKERCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_FONTPICKERCTRL)
+    APPEND_DEFINE_ITEM(wxUSE_GAUGE)
+    APPEND_DEFINE_ITEM(wxUSE_HEADERCTRL)
     APPEND_DEFINE_ITEM(wxUSE_HYPERLINKCTRL)
     APPEND_DEFINE_ITEM(wxUSE_LISTBOX)
     APPEND_DEFINE_ITEM(wxUSE_LISTCTRL)
@@ -2459,158 +4100,3917 @@ void PreprocessorDefinesView::DoUpdateValues()
 #endif // #ifdef __WXMSW__
     APPEND_DEFINE_ITEM(wxUSE_HOTKEY)
 
-#ifdef __WXMSW__
-    APPEND_DEFINE_ITEM(wxUSE_INKEDIT)
-    APPEND_DEFINE_ITEM(wxUSE_MS_HTML_HELP)
-    APPEND_DEFINE_ITEM(wxUSE_OLE)
-    APPEND_DEFINE_ITEM(wxUSE_OLE_AUTOMATION)
-    APPEND_DEFINE_ITEM(wxUSE_REGKEY)
-    APPEND_DEFINE_ITEM(wxUSE_RICHEDIT)
-    APPEND_DEFINE_ITEM(wxUSE_RICHEDIT2)
-    APPEND_DEFINE_ITEM(wxUSE_UXTHEME)
-    APPEND_DEFINE_ITEM(wxUSE_WINRT)
-    APPEND_DEFINE_ITEM(wxUSE_WINSOCK2)
-#endif // #ifdef __WXMSW__
+#ifdef __WXMSW__
+    APPEND_DEFINE_ITEM(wxUSE_INKEDIT)
+    APPEND_DEFINE_ITEM(wxUSE_MS_HTML_HELP)
+    APPEND_DEFINE_ITEM(wxUSE_OLE)
+    APPEND_DEFINE_ITEM(wxUSE_OLE_AUTOMATION)
+    APPEND_DEFINE_ITEM(wxUSE_REGKEY)
+    APPEND_DEFINE_ITEM(wxUSE_RICHEDIT)
+    APPEND_DEFINE_ITEM(wxUSE_RICHEDIT2)
+    APPEND_DEFINE_ITEM(wxUSE_UXTHEME)
+    APPEND_DEFINE_ITEM(wxUSE_WINRT)
+    APPEND_DEFINE_ITEM(wxUSE_WINSOCK2)
+#endif // #ifdef __WXMSW__
+
+#ifdef __WXGTK__
+    APPEND_DEFINE_ITEM(wxUSE_DETECT_SM)
+    APPEND_DEFINE_ITEM(wxUSE_GTKPRINT)
+#endif // #ifdef __WXGTK__
+
+#ifdef __UNIX__
+    APPEND_DEFINE_ITEM(wxUSE_EPOLL_DISPATCHER)
+    APPEND_DEFINE_ITEM(wxUSE_SELECT_DISPATCHER)
+    APPEND_DEFINE_ITEM(wxUSE_GSTREAMER)
+    APPEND_DEFINE_ITEM(wxUSE_LIBMSPACK)
+    APPEND_DEFINE_ITEM(wxUSE_LIBSDL)
+    APPEND_DEFINE_ITEM(wxUSE_PLUGINS)
+    APPEND_DEFINE_ITEM(wxUSE_XTEST)
+#endif // #ifdef __UNIX__
+
+#ifdef __WXMAC__
+    APPEND_DEFINE_ITEM(wxUSE_WEBKIT)
+#endif// #ifdef __WXMAC__
+
+#ifdef __WXUNIVERSAL__
+    APPEND_DEFINE_ITEM(wxUSE_ALL_THEMES)
+    APPEND_DEFINE_ITEM(wxUSE_THEME_GTK)
+    APPEND_DEFINE_ITEM(wxUSE_THEME_METAL)
+    APPEND_DEFINE_ITEM(wxUSE_THEME_MONO)
+    APPEND_DEFINE_ITEM(wxUSE_THEME_WIN32)
+#endif // #ifdef __WXUNIVERSAL__
+
+
+    bool hasDefine;
+
+#ifdef wxHAS_3STATE_CHECKBOX
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_3STATE_CHECKBOX", hasDefine)
+
+#ifdef wxHAS_ATOMIC_OPS
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_ATOMIC_OPS", hasDefine)
+
+#ifdef wxHAS_BITMAPTOGGLEBUTTON
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_BITMAPTOGGLEBUTTON", hasDefine)
+
+#ifdef wxHAS_MEMBER_DEFAULT
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_MEMBER_DEFAULT", hasDefine)
+
+#ifdef wxHAS_LARGE_FILES
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_LARGE_FILES", hasDefine)
+
+#ifdef wxHAS_LARGE_FFILES
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_LARGE_FFILES", hasDefine)
+
+#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG", hasDefine)
+
+#ifdef wxHAS_MULTIPLE_FILEDLG_FILTERS
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_MULTIPLE_FILEDLG_FILTERS", hasDefine)
+
+#ifdef wxHAS_NATIVE_ANIMATIONCTRL
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_ANIMATIONCTRL", hasDefine)
+
+#ifdef wxHAS_NATIVE_DATAVIEWCTRL
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_DATAVIEWCTRL", hasDefine)
+
+#ifdef wxHAS_NATIVE_WINDOW
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_WINDOW", hasDefine)
+
+#ifdef wxHAS_NOEXCEPT
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_NOEXCEPT", hasDefine)
+
+#ifdef wxHAS_NULLPTR_T
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_NULLPTR_T", hasDefine)
+
+#ifdef wxHAS_IMAGES_IN_RESOURCES
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_IMAGES_IN_RESOURCES", hasDefine)
+
+#ifdef wxHAS_POWER_EVENTS
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_POWER_EVENTS", hasDefine)
+
+#ifdef wxHAS_RADIO_MENU_ITEMS
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_RADIO_MENU_ITEMS", hasDefine)
+
+#ifdef wxHAS_RAW_BITMAP
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_RAW_BITMAP", hasDefine)
+
+#ifdef wxHAS_RAW_KEY_CODES
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_RAW_KEY_CODES", hasDefine)
+
+#ifdef wxHAS_REGEX_ADVANCED
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_REGEX_ADVANCED", hasDefine)
+
+#ifdef wxHAS_TASK_BAR_ICON
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_TASK_BAR_ICON", hasDefine)
+
+#ifdef wxHAS_WINDOW_LABEL_IN_STATIC_BOX
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_WINDOW_LABEL_IN_STATIC_BOX", hasDefine)
+
+#ifdef wxHAS_MODE_T
+    hasDefine = true;
+#endif
+    APPEND_HAS_FEATURE_ITEM("wxHAS_MODE_T", hasDefine)
+}
+
+/*************************************************
+
+    EventLoopView
+
+*************************************************/
+
+// Keeps the most recent latency samples of one measurement and
+// the counters over the whole lifetime, all times are in microseconds.
+class LatencyStatistics
+{
+public:
+    LatencyStatistics(size_t maxSamples = 1000);
+
+    void AddSample(wxLongLong_t sample);
+
+    wxULongLong_t GetSampleCount() const { return m_sampleCount; }
+    // percentile is in the range 0-100 and is computed from the most recent samples
+    wxLongLong_t GetPercentile(double percentile) const;
+    wxLongLong_t GetMax() const { return m_max; }
+    wxULongLong_t GetStallCount() const { return m_stallCount; }
+
+    static const wxLongLong_t StallThreshold = 100000;
+private:
+    std::vector<wxLongLong_t> m_samples;
+    size_t                    m_maxSamples{0};
+    size_t                    m_nextSampleIndex{0};
+    wxULongLong_t             m_sampleCount{0};
+    wxLongLong_t              m_max{0};
+    wxULongLong_t             m_stallCount{0};
+};
+
+LatencyStatistics::LatencyStatistics(size_t maxSamples)
+    : m_maxSamples(maxSamples)
+{
+    wxASSERT(m_maxSamples > 0);
+
+    m_samples.reserve(m_maxSamples);
+}
+
+void LatencyStatistics::AddSample(wxLongLong_t sample)
+{
+    if ( m_samples.size() < m_maxSamples )
+    {
+        m_samples.push_back(sample);
+    }
+    else
+    {
+        m_samples[m_nextSampleIndex] = sample;
+        m_nextSampleIndex = (m_nextSampleIndex + 1) % m_maxSamples;
+    }
+
+    ++m_sampleCount;
+    m_max = std::max(m_max, sample);
+
+    if ( sample > StallThreshold )
+        ++m_stallCount;
+}
+
+wxLongLong_t LatencyStatistics::GetPercentile(double percentile) const
+{
+    if ( m_samples.empty() )
+        return 0;
+
+    std::vector<wxLongLong_t> samples(m_samples);
+    const size_t index = std::min(static_cast<size_t>(percentile / 100 * samples.size()), samples.size() - 1);
+
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+// Measures how responsive is the event loop of the hosting application:
+// how late fires a high-frequency timer, how long it takes before a function
+// passed to CallAfter() is called, and how long wxSystemInformationFrame::UpdateValues() takes.
+// Unlike the displayed values, the probe is running also when the page is not shown.
+// When built with WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS, the allocations
+// made by the frame operations are shown as well.
+class EventLoopView : public SampledSysInfoListView
+{
+public:
+    EventLoopView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+    void AddUpdateValuesDuration(wxLongLong_t duration) { m_updateValuesDuration.AddSample(duration); }
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    void AddAllocationCount(const wxString& operation, const AllocationCount& count);
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Measurement = 0,
+        Column_SampleCount,
+        Column_P50,
+        Column_P95,
+        Column_P99,
+        Column_Max,
+        Column_StallCount,
+    };
+
+    static const int ProbeInterval = 20; // in milliseconds
+
+    wxTimer      m_probeTimer;
+    wxStopWatch  m_probeStopWatch;
+    wxLongLong_t m_previousProbeTime{-1};
+
+    LatencyStatistics m_timerLateness;
+    LatencyStatistics m_callAfterDelay;
+    LatencyStatistics m_updateValuesDuration;
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    struct AllocationStatistics
+    {
+        wxString          operation;
+        LatencyStatistics count{100};
+        LatencyStatistics bytes{100};
+    };
+
+    // in the order the operations were first added
+    std::vector<AllocationStatistics> m_allocationStatistics;
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
+    // valueToString converts the sample values, the stall count is shown only for the times
+    void AppendStatistics(std::vector<std::pair<long, wxArrayString>>& items,
+                          const wxString& measurement, const LatencyStatistics& statistics,
+                          wxString (*valueToString)(wxLongLong_t) = nullptr);
+
+    void OnProbeTimer(wxTimerEvent&);
+    void OnProbeCallAfter(wxLongLong_t postTime);
+};
+
+EventLoopView::EventLoopView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000)
+{
+    InsertColumn(Column_Measurement, _("Measurement"));
+    InsertColumn(Column_SampleCount, _("Samples"));
+    InsertColumn(Column_P50, _("p50"));
+    InsertColumn(Column_P95, _("p95"));
+    InsertColumn(Column_P99, _("p99"));
+    InsertColumn(Column_Max, _("Max"));
+    InsertColumn(Column_StallCount, wxString::Format(_("Stalls (> %lld ms)"), LatencyStatistics::StallThreshold / 1000));
+
+    m_probeTimer.SetOwner(this);
+    Bind(wxEVT_TIMER, &EventLoopView::OnProbeTimer, this, m_probeTimer.GetId());
+    m_probeTimer.Start(ProbeInterval);
+
+    UpdateValues();
+}
+
+void EventLoopView::DoUpdateValues()
+{
+    std::vector<std::pair<long, wxArrayString>> items;
+
+    AppendStatistics(items, wxString::Format(_("Timer Lateness (%d ms Interval)"), ProbeInterval), m_timerLateness);
+    AppendStatistics(items, _("CallAfter() Delay"), m_callAfterDelay);
+    AppendStatistics(items, _("UpdateValues() Duration"), m_updateValuesDuration);
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    static const auto countToString = [](wxLongLong_t count)
+    {
+        return wxString::Format("%lld", count);
+    };
+    static const auto bytesToString = [](wxLongLong_t bytes)
+    {
+        return BytesToString(bytes);
+    };
+
+    for ( const auto& statistics : m_allocationStatistics )
+    {
+        AppendStatistics(items, wxString::Format(_("%s Allocations"), statistics.operation), statistics.count, countToString);
+        AppendStatistics(items, wxString::Format(_("%s Allocated"), statistics.operation), statistics.bytes, bytesToString);
+    }
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
+    SetStoredItems(items);
+}
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+void EventLoopView::AddAllocationCount(const wxString& operation, const AllocationCount& count)
+{
+    auto it = std::find_if(m_allocationStatistics.begin(), m_allocationStatistics.end(),
+        [&operation](const AllocationStatistics& statistics) { return statistics.operation == operation; });
+
+    if ( it == m_allocationStatistics.end() )
+    {
+        m_allocationStatistics.push_back(AllocationStatistics());
+        it = m_allocationStatistics.end() - 1;
+        it->operation = operation;
+    }
+
+    it->count.AddSample(count.count);
+    it->bytes.AddSample(count.bytes);
+}
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
+void EventLoopView::AppendStatistics(std::vector<std::pair<long, wxArrayString>>& items,
+                                     const wxString& measurement, const LatencyStatistics& statistics,
+                                     wxString (*valueToString)(wxLongLong_t))
+{
+    static const auto timeToString = [](wxLongLong_t time)
+    {
+        return wxString::Format(_("%.1f ms"), time / 1000.0);
+    };
+
+    const bool isTime = valueToString == nullptr;
+
+    if ( isTime )
+        valueToString = timeToString;
+
+    // the rows are updated in place, the empty cells must be set too
+    wxArrayString columns;
+
+    columns.Add(wxEmptyString, Column_StallCount + 1);
+
+    columns[Column_Measurement] = measurement;
+    columns[Column_SampleCount] = wxString::Format("%llu", statistics.GetSampleCount());
+
+    if ( statistics.GetSampleCount() > 0 )
+    {
+        columns[Column_P50] = valueToString(statistics.GetPercentile(50));
+        columns[Column_P95] = valueToString(statistics.GetPercentile(95));
+        columns[Column_P99] = valueToString(statistics.GetPercentile(99));
+        columns[Column_Max] = valueToString(statistics.GetMax());
+
+        if ( isTime )
+            columns[Column_StallCount] = wxString::Format("%llu", statistics.GetStallCount());
+    }
+
+    items.emplace_back(static_cast<long>(items.size()), columns);
+}
+
+void EventLoopView::OnProbeTimer(wxTimerEvent&)
+{
+    const wxLongLong_t probeTime = m_probeStopWatch.TimeInMicro().GetValue();
+
+    if ( m_previousProbeTime >= 0 )
+        m_timerLateness.AddSample(std::max<wxLongLong_t>(0, probeTime - m_previousProbeTime - ProbeInterval * 1000));
+
+    m_previousProbeTime = probeTime;
+
+    CallAfter([this, probeTime] { OnProbeCallAfter(probeTime); });
+}
+
+void EventLoopView::OnProbeCallAfter(wxLongLong_t postTime)
+{
+    m_callAfterDelay.AddSample(m_probeStopWatch.TimeInMicro().GetValue() - postTime);
+}
+
+/*************************************************
+
+    StallWatchdogThread
+
+*************************************************/
+
+enum
+{
+    StallWatchdogEvent_Ping = 1,
+    StallWatchdogEvent_Stall,
+};
+
+// Periodically pings the GUI thread by queuing an event to the sink;
+// when the sink does not call Answer() within the deadline, the stall
+// is reported to the sink, once the GUI thread responds again.
+// On Linux with glibc, the backtrace of the main thread is captured
+// while it is stalled, using a signal handler running in that thread.
+class StallWatchdogThread : public wxThread
+{
+public:
+    // must be created and deleted in the main thread
+    StallWatchdogThread(wxEvtHandler* sink, int deadline);
+    ~StallWatchdogThread();
+
+    // to be called from the main thread when it receives the ping event,
+    // pings queued by an already deleted watchdog are ignored
+    void Answer(long sequence)
+    {
+        if ( sequence <= m_pingSequence )
+            m_answeredSequence = sequence;
+    }
+
+protected:
+    ExitCode Entry() override;
+private:
+    static const int PingInterval = 100; // in milliseconds
+
+    wxEvtHandler*     m_sink{nullptr};
+    int               m_deadline{0};
+    std::atomic<long> m_pingSequence{0};
+    std::atomic<long> m_answeredSequence{0};
+
+    // returns false when the thread is asked to finish
+    bool SleepUnlessDestroyed(int milliseconds);
+
+#if defined(__LINUX__) && defined(__GLIBC__)
+    static const int BacktraceSignal = SIGUSR2;
+
+    // the states of capturing the backtrace, the handler writes the frames
+    // only when requested, so that a late handler cannot overwrite them
+    // while they are read, nor can two watchdogs capture at the same time
+    enum
+    {
+        BacktraceState_Idle,
+        BacktraceState_Requested,
+        BacktraceState_Writing,
+        BacktraceState_Written,
+    };
+
+    // the signal handler is process-wide and so is its storage; the handler
+    // is installed by the first watchdog and restored by the last one,
+    // this is done only in the main thread
+    static void*            ms_backtraceFrames[64];
+    static int              ms_backtraceFrameCount;
+    static std::atomic<int> ms_backtraceState;
+    static int              ms_signalHandlerUseCount;
+    static struct sigaction ms_previousSignalAction;
+
+    pthread_t m_mainThread;
+    bool      m_signalHandlerInstalled{false};
+
+    static bool InstallSignalHandler();
+    static void UninstallSignalHandler();
+    static void OnBacktraceSignal(int);
+    wxString CaptureMainThreadBacktrace();
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+};
+
+#if defined(__LINUX__) && defined(__GLIBC__)
+void*            StallWatchdogThread::ms_backtraceFrames[64];
+int              StallWatchdogThread::ms_backtraceFrameCount{0};
+std::atomic<int> StallWatchdogThread::ms_backtraceState{BacktraceState_Idle};
+int              StallWatchdogThread::ms_signalHandlerUseCount{0};
+struct sigaction StallWatchdogThread::ms_previousSignalAction;
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+
+StallWatchdogThread::StallWatchdogThread(wxEvtHandler* sink, int deadline)
+    : wxThread(wxTHREAD_JOINABLE),
+      m_sink(sink), m_deadline(deadline)
+{
+    wxASSERT(wxThread::IsMain());
+
+#if defined(__LINUX__) && defined(__GLIBC__)
+    m_mainThread = pthread_self();
+    m_signalHandlerInstalled = InstallSignalHandler();
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+}
+
+StallWatchdogThread::~StallWatchdogThread()
+{
+#if defined(__LINUX__) && defined(__GLIBC__)
+    if ( m_signalHandlerInstalled )
+        UninstallSignalHandler();
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+}
+
+wxThread::ExitCode StallWatchdogThread::Entry()
+{
+    wxStopWatch stopWatch;
+
+    while ( !TestDestroy() )
+    {
+        wxThreadEvent* pingEvent = new wxThreadEvent(wxEVT_THREAD, StallWatchdogEvent_Ping);
+        const wxDateTime pingDateTime = wxDateTime::UNow();
+        const long pingTime = stopWatch.Time();
+        const long sequence = ++m_pingSequence;
+        bool stalled = false;
+        wxString backtrace;
+
+        pingEvent->SetExtraLong(sequence);
+        wxQueueEvent(m_sink, pingEvent);
+
+        while ( m_answeredSequence < sequence )
+        {
+            if ( !SleepUnlessDestroyed(10) )
+                return static_cast<wxThread::ExitCode>(nullptr);
+
+            if ( !stalled && stopWatch.Time() - pingTime > m_deadline )
+            {
+                stalled = true;
+#if defined(__LINUX__) && defined(__GLIBC__)
+                backtrace = CaptureMainThreadBacktrace();
+#endif
+            }
+        }
+
+        if ( stalled )
+        {
+            wxThreadEvent* stallEvent = new wxThreadEvent(wxEVT_THREAD, StallWatchdogEvent_Stall);
+            wxString message;
+
+            message.Printf(_("Main thread stalled for %ld ms (deadline %d ms), starting at %s."),
+                           stopWatch.Time() - pingTime, m_deadline, pingDateTime.Format("%H:%M:%S.%l"));
+            if ( !backtrace.empty() )
+                message += "\n" + _("Main thread backtrace:") + backtrace;
+
+            stallEvent->SetString(message);
+            wxQueueEvent(m_sink, stallEvent);
+        }
+
+        if ( !SleepUnlessDestroyed(PingInterval) )
+            break;
+    }
+
+    return static_cast<wxThread::ExitCode>(nullptr);
+}
+
+bool StallWatchdogThread::SleepUnlessDestroyed(int milliseconds)
+{
+    static const int step = 10;
+
+    for ( int slept = 0; slept < milliseconds; slept += step )
+    {
+        if ( TestDestroy() )
+            return false;
+        Sleep(step);
+    }
+
+    return !TestDestroy();
+}
+
+#if defined(__LINUX__) && defined(__GLIBC__)
+
+bool StallWatchdogThread::InstallSignalHandler()
+{
+    wxASSERT(wxThread::IsMain());
+
+    if ( ms_signalHandlerUseCount > 0 )
+    {
+        ++ms_signalHandlerUseCount;
+        return true;
+    }
+
+    struct sigaction currentAction;
+
+    if ( sigaction(BacktraceSignal, nullptr, &currentAction) != 0 )
+    {
+        wxLogError(_("Could not install the signal handler needed to capture the main thread backtrace."));
+        return false;
+    }
+
+    // do not replace a handler installed by the application
+    if ( (currentAction.sa_flags & SA_SIGINFO) != 0
+         || (currentAction.sa_handler != SIG_DFL && currentAction.sa_handler != SIG_IGN) )
+    {
+        wxLogWarning(_("SIGUSR2 is already handled by the application, the main thread backtrace will not be captured."));
+        return false;
+    }
+
+    // backtrace() may allocate memory on its first call,
+    // which must not happen inside the signal handler
+    void* frames[1];
+    backtrace(frames, WXSIZEOF(frames));
+
+    struct sigaction signalAction;
+
+    memset(&signalAction, 0, sizeof(signalAction));
+    signalAction.sa_handler = &StallWatchdogThread::OnBacktraceSignal;
+    sigemptyset(&signalAction.sa_mask);
+    signalAction.sa_flags = SA_RESTART;
+    if ( sigaction(BacktraceSignal, &signalAction, &ms_previousSignalAction) != 0 )
+    {
+        wxLogError(_("Could not install the signal handler needed to capture the main thread backtrace."));
+        return false;
+    }
+
+    ms_signalHandlerUseCount = 1;
+    return true;
+}
+
+void StallWatchdogThread::UninstallSignalHandler()
+{
+    wxASSERT(wxThread::IsMain());
+    wxCHECK_RET(ms_signalHandlerUseCount > 0, "signal handler not installed");
+
+    if ( --ms_signalHandlerUseCount > 0 )
+        return;
+
+    struct sigaction currentAction;
+
+    // restore the previous handler only if nobody replaced ours since
+    if ( sigaction(BacktraceSignal, nullptr, &currentAction) == 0
+         && (currentAction.sa_flags & SA_SIGINFO) == 0
+         && currentAction.sa_handler == &StallWatchdogThread::OnBacktraceSignal )
+    {
+        sigaction(BacktraceSignal, &ms_previousSignalAction, nullptr);
+    }
+}
+
+void StallWatchdogThread::OnBacktraceSignal(int)
+{
+    int state = BacktraceState_Requested;
+
+    // the capture may have already been abandoned
+    if ( !ms_backtraceState.compare_exchange_strong(state, BacktraceState_Writing) )
+        return;
+
+    ms_backtraceFrameCount = backtrace(ms_backtraceFrames, WXSIZEOF(ms_backtraceFrames));
+    ms_backtraceState = BacktraceState_Written;
+}
+
+wxString StallWatchdogThread::CaptureMainThreadBacktrace()
+{
+    if ( !m_signalHandlerInstalled )
+        return wxEmptyString;
+
+    int state = BacktraceState_Idle;
+
+    // another watchdog is capturing the backtrace
+    if ( !ms_backtraceState.compare_exchange_strong(state, BacktraceState_Requested) )
+        return "\n" + _("<Backtrace not available>");
+
+    if ( pthread_kill(m_mainThread, BacktraceSignal) != 0 )
+    {
+        ms_backtraceState = BacktraceState_Idle;
+        return "\n" + _("<Could not signal the main thread>");
+    }
+
+    for ( int i = 0; i < 50 && ms_backtraceState != BacktraceState_Written; ++i )
+        Sleep(2);
+
+    // abandon the capture unless the handler already started writing,
+    // then it must be waited for to finish
+    state = BacktraceState_Requested;
+    if ( ms_backtraceState.compare_exchange_strong(state, BacktraceState_Idle) )
+        return "\n" + _("<Backtrace not available>");
+
+    while ( ms_backtraceState != BacktraceState_Written )
+        Sleep(1);
+
+    const int frameCount = ms_backtraceFrameCount;
+    char** symbols = nullptr;
+
+    // backtrace_symbols() is not async-signal-safe,
+    // so the symbols are resolved here and not in the handler
+    if ( frameCount > 0 )
+        symbols = backtrace_symbols(ms_backtraceFrames, frameCount);
+
+    wxString result;
+
+    // the first frame is the signal handler itself
+    for ( int i = 1; symbols && i < frameCount; ++i )
+        result += wxString::Format("\n    #%d %s", i - 1, symbols[i]);
+
+    free(symbols);
+    ms_backtraceState = BacktraceState_Idle;
+
+    if ( result.empty() )
+        return "\n" + _("<Backtrace not available>");
+
+    return result;
+}
+
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+
+/*************************************************
+
+    CPUTopologyView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class CPUTopologyView : public SysInfoListView
+{
+public:
+    CPUTopologyView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+};
+
+CPUTopologyView::CPUTopologyView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void CPUTopologyView::DoUpdateValues()
+{
+    const wxString cpuDir("/sys/devices/system/cpu/");
+    const std::vector<long> cpus = GetLinuxNumberedEntries(cpuDir, "cpu");
+
+    std::set<long> packages;
+    std::set<std::pair<long, long>> cores; // package and core id
+    long onlineCPUCount = 0;
+    std::vector<std::pair<wxString, wxString>> cpuItems;
+
+    // the same cache is listed for each CPU sharing it, the key
+    // (level, type, first CPU sharing the cache) is used to list it only once
+    std::map<std::tuple<long, wxString, long>, std::pair<wxString, wxString>> cacheItems;
+
+    for ( const auto cpu : cpus )
+    {
+        const wxString cpuName = wxString::Format("cpu%ld", cpu);
+        const wxString topologyDir = cpuDir + cpuName + "/topology/";
+        const wxString cacheDir = cpuDir + cpuName + "/cache/";
+        wxString value;
+
+        // cpu0 usually cannot be taken offline and therefore has no "online" file
+        if ( ReadLinuxFileLine(cpuDir + cpuName + "/online") == "0" )
+        {
+            cpuItems.push_back(std::make_pair(wxString::Format(_("CPU %ld"), cpu), _("Offline")));
+            continue;
+        }
+
+        ++onlineCPUCount;
+
+        const wxString packageId = ReadLinuxFileLine(topologyDir + "physical_package_id");
+        const wxString dieId = ReadLinuxFileLine(topologyDir + "die_id");
+        const wxString coreId = ReadLinuxFileLine(topologyDir + "core_id");
+        long packageNumber = 0, coreNumber = 0;
+
+        if ( packageId.ToLong(&packageNumber) && coreId.ToLong(&coreNumber) )
+        {
+            packages.insert(packageNumber);
+            cores.insert(std::make_pair(packageNumber, coreNumber));
+        }
+
+        value.Printf(_("Package %s"), packageId);
+        if ( !dieId.empty() )
+            value += wxString::Format(_(", Die %s"), dieId);
+        value += wxString::Format(_(", Core %s, SMT siblings %s"),
+                    coreId, ReadLinuxFileLine(topologyDir + "thread_siblings_list"));
+
+        cpuItems.push_back(std::make_pair(wxString::Format(_("CPU %ld"), cpu), value));
+
+        for ( const auto index : GetLinuxNumberedEntries(cacheDir, "index") )
+        {
+            const wxString indexDir = cacheDir + wxString::Format("index%ld/", index);
+            const wxString type = ReadLinuxFileLine(indexDir + "type");
+            const wxString sharedCPUs = ReadLinuxFileLine(indexDir + "shared_cpu_list");
+            const std::set<long> sharedCPUSet = ParseLinuxCPUList(sharedCPUs);
+            long level = 0;
+
+            if ( !ReadLinuxFileLine(indexDir + "level").ToLong(&level) )
+                continue;
+
+            const auto key = std::make_tuple(level, type, sharedCPUSet.empty() ? cpu : *sharedCPUSet.begin());
+
+            if ( cacheItems.find(key) != cacheItems.end() )
+                continue;
+
+            wxString typeSuffix;
+
+            if ( type == "Data" )
+                typeSuffix = "d";
+            else if ( type == "Instruction" )
+                typeSuffix = "i";
+
+            cacheItems[key] = std::make_pair(
+                wxString::Format(_("L%ld%s Cache, CPUs %s"), level, typeSuffix, sharedCPUs),
+                wxString::Format(_("%s, %s-byte lines, %s-way set associative"),
+                    ReadLinuxFileLine(indexDir + "size"),
+                    ReadLinuxFileLine(indexDir + "coherency_line_size"),
+                    ReadLinuxFileLine(indexDir + "ways_of_associativity")));
+        }
+    }
+
+    std::vector<std::pair<wxString, wxString>> items;
+
+    const wxString offlineCPUs = ReadLinuxFileLine(cpuDir + "offline");
+    const wxString SMTControl = ReadLinuxFileLine(cpuDir + "smt/control");
+
+    items.emplace_back(_("Possible CPUs"), ReadLinuxFileLine(cpuDir + "possible"));
+    items.emplace_back(_("Present CPUs"), ReadLinuxFileLine(cpuDir + "present"));
+    items.emplace_back(_("Online CPUs"), ReadLinuxFileLine(cpuDir + "online"));
+    items.emplace_back(_("Offline CPUs"), offlineCPUs.empty() ? _("<None>") : offlineCPUs);
+    items.emplace_back(_("Packages"), wxString::Format("%zu", packages.size()));
+    items.emplace_back(_("Physical Cores"), wxString::Format("%zu", cores.size()));
+    items.emplace_back(_("Logical CPUs Online"), wxString::Format("%ld", onlineCPUCount));
+    if ( !SMTControl.empty() )
+    {
+        items.emplace_back(_("SMT"), wxString::Format(_("%s (%s)"), SMTControl,
+            ReadLinuxFileLine(cpuDir + "smt/active") == "1" ? _("active") : _("inactive")));
+    }
+
+    for ( const auto& cacheItem : cacheItems )
+        items.emplace_back(cacheItem.second.first, cacheItem.second.second);
+
+    for ( const auto& cpuItem : cpuItems )
+        items.emplace_back(cpuItem.first, cpuItem.second);
+
+    SetItemsWithValues(items);
+}
+
+#endif // #ifdef __LINUX__
+
+
+/*************************************************
+
+    NUMAView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class NUMAView : public SysInfoListView
+{
+public:
+    NUMAView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    static wxString GetProcessMemoryNodes();
+};
+
+NUMAView::NUMAView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void NUMAView::DoUpdateValues()
+{
+    const wxString nodeDir("/sys/devices/system/node/");
+    const auto processStatus = ParseLinuxNameValueFile("/proc/self/status", ':');
+
+    std::vector<std::pair<wxString, wxString>> items;
+
+    items.emplace_back(_("Online Nodes"), ReadLinuxFileLine(nodeDir + "online"));
+
+    for ( const auto node : GetLinuxNumberedEntries(nodeDir, "node") )
+    {
+        const wxString nodeName = wxString::Format(_("Node %ld"), node);
+        const wxString nodePath = nodeDir + wxString::Format("node%ld/", node);
+        const auto memInfo = ParseLinuxMemInfo(nodePath + "meminfo");
+        wxString memory = _("N/A");
+
+        if ( memInfo.find("MemTotal") != memInfo.end() && memInfo.find("MemFree") != memInfo.end() )
+        {
+            memory.Printf(_("%s total, %s free"),
+                BytesToString(memInfo.at("MemTotal") * 1024), BytesToString(memInfo.at("MemFree") * 1024));
+        }
+
+        items.emplace_back(nodeName + _(" CPUs"), ReadLinuxFileLine(nodePath + "cpulist"));
+        items.emplace_back(nodeName + _(" Memory"), memory);
+        items.emplace_back(nodeName + _(" Distances"), ReadLinuxFileLine(nodePath + "distance"));
+    }
+
+    std::set<long> affinity;
+
+    if ( GetLinuxProcessCPUAffinity(affinity) )
+    {
+        items.emplace_back(_("Process CPU Affinity"),
+            wxString::Format(_("%s (%zu CPUs)"), FormatLinuxCPUList(affinity), affinity.size()));
+    }
+    else
+        items.emplace_back(_("Process CPU Affinity"), _("N/A"));
+    items.emplace_back(_("Process Allowed Memory Nodes"), processStatus.count("Mems_allowed_list")
+                                                           ? processStatus.at("Mems_allowed_list") : _("N/A"));
+    items.emplace_back(_("Process Memory by Node"), GetProcessMemoryNodes());
+
+    SetItemsWithValues(items);
+}
+
+// Sums the pages of all mappings in /proc/self/numa_maps per node,
+// the lines look like "7f2e... default file=/usr/lib/libc.so.6 mapped=80 N0=60 N1=20 kernelpagesize_kB=4".
+wxString NUMAView::GetProcessMemoryNodes()
+{
+    wxString contents;
+
+    if ( !ReadLinuxFile("/proc/self/numa_maps", contents) )
+        return _("N/A");
+
+    std::map<long, wxULongLong_t> nodeBytes;
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        const wxArrayString fields = wxSplit(line, ' ', '\0');
+        std::map<long, wxULongLong_t> linePages;
+        wxULongLong_t pageSizeKiB = 4;
+
+        for ( const auto& field : fields )
+        {
+            wxString rest;
+            long node = 0;
+            wxULongLong_t pages = 0;
+
+            if ( field.StartsWith("kernelpagesize_kB=", &rest) )
+                rest.ToULongLong(&pageSizeKiB);
+            else
+            if ( field.StartsWith("N", &rest) && rest.BeforeFirst('=').ToLong(&node)
+                 && rest.AfterFirst('=').ToULongLong(&pages) )
+            {
+                linePages[node] += pages;
+            }
+        }
+
+        for ( const auto& nodePages : linePages )
+            nodeBytes[nodePages.first] += nodePages.second * pageSizeKiB * 1024;
+    }
+
+    wxString result;
+
+    for ( const auto& node : nodeBytes )
+    {
+        if ( !result.empty() )
+            result += ", ";
+        result += wxString::Format(_("Node %ld: %s"), node.first, BytesToString(node.second));
+    }
+
+    return result.empty() ? _("N/A") : result;
+}
+
+#endif // #ifdef __LINUX__
+
+
+/*************************************************
+
+    CGroupView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+// Reads the resource limits of the cgroup the current process belongs to,
+// supporting both cgroup v2 and the legacy v1 hierarchies. All files are read
+// relative to rootDir, so the values can also be read from a directory
+// containing a copy of (or fake) "proc/self/cgroup" and "sys/fs/cgroup".
+class LinuxCGroupHelper
+{
+public:
+    explicit LinuxCGroupHelper(const wxString& rootDir = "/");
+
+    // 0 if the cgroup could not be determined
+    int GetVersion() const { return m_version; }
+    wxString GetPath() const;
+
+    // returns the number of CPUs the quota corresponds to
+    // or -1 if the quota is not limited, takes into account also ancestors
+    double GetCPUQuota(wxString* quotaDescription = nullptr) const;
+    wxString GetCPUWeight() const;
+
+    // returns the value of the given file in the cpu.stat (v2)
+    // or cpu.stat and cpuacct.usage (v1), converted to microseconds
+    bool GetCPUStat(const wxString& name, wxULongLong_t& value) const;
+
+    wxString GetMemoryMax() const;
+    wxString GetMemoryHigh() const;
+    wxString GetMemoryCurrent() const;
+
+    wxString GetPIDsMax() const;
+    wxString GetPIDsCurrent() const;
+
+    wxString GetIOMax() const;
+
+private:
+    wxString m_rootDir;
+    int m_version{0};
+    wxString m_v2Path;
+    std::map<wxString, wxString> m_v1Paths; // controller name, path
+
+    wxString GetControllerDir(const wxString& controller) const;
+    wxString ReadControllerFile(const wxString& controller, const wxString& fileName) const;
+
+    static wxString MemoryValueToString(const wxString& value);
+};
+
+LinuxCGroupHelper::LinuxCGroupHelper(const wxString& rootDir)
+    : m_rootDir(rootDir)
+{
+    if ( !m_rootDir.EndsWith("/") )
+        m_rootDir += '/';
+
+    wxString contents;
+
+    if ( !ReadLinuxFile(m_rootDir + "proc/self/cgroup", contents) )
+        return;
+
+    // the lines have format "hierarchy-ID:controller-list:cgroup-path",
+    // for v2 the hierarchy ID is 0 and the controller list is empty
+    for ( const auto& line : wxSplit(contents.Trim(), '\n', '\0') )
+    {
+        const wxString hierarchyId = line.BeforeFirst(':');
+        const wxString controllers = line.AfterFirst(':').BeforeFirst(':');
+        const wxString path = line.AfterFirst(':').AfterFirst(':');
+
+        if ( hierarchyId == "0" && controllers.empty() )
+            m_v2Path = path;
+        else
+        {
+            for ( const auto& controller : wxSplit(controllers, ',', '\0') )
+                m_v1Paths[controller] = path;
+        }
+    }
+
+    // in the hybrid mode, the resource controllers are still in v1
+    if ( m_v1Paths.find("cpu") != m_v1Paths.end() || m_v1Paths.find("memory") != m_v1Paths.end() )
+        m_version = 1;
+    else if ( !m_v2Path.empty() )
+        m_version = 2;
+}
+
+wxString LinuxCGroupHelper::GetPath() const
+{
+    if ( m_version == 2 )
+        return m_v2Path;
+
+    if ( m_version == 1 )
+    {
+        const auto it = m_v1Paths.find("cpu");
+
+        if ( it != m_v1Paths.end() )
+            return it->second;
+        return m_v1Paths.begin()->second;
+    }
+
+    return wxEmptyString;
+}
+
+wxString LinuxCGroupHelper::GetControllerDir(const wxString& controller) const
+{
+    const wxString cgroupDir = m_rootDir + "sys/fs/cgroup";
+
+    if ( m_version == 2 )
+    {
+        // inside a container with its own cgroup namespace
+        // the path may not exist as the group is mounted as the root
+        if ( wxFileName::DirExists(cgroupDir + m_v2Path) )
+            return cgroupDir + m_v2Path;
+        return cgroupDir;
+    }
+
+    const auto it = m_v1Paths.find(controller);
+
+    if ( it == m_v1Paths.end() )
+        return wxEmptyString;
+
+    if ( wxFileName::DirExists(cgroupDir + "/" + controller + it->second) )
+        return cgroupDir + "/" + controller + it->second;
+    return cgroupDir + "/" + controller;
+}
+
+wxString LinuxCGroupHelper::ReadControllerFile(const wxString& controller, const wxString& fileName) const
+{
+    const wxString dir = GetControllerDir(controller);
+
+    if ( dir.empty() )
+        return wxEmptyString;
+
+    return ReadLinuxFileLine(dir + "/" + fileName);
+}
+
+double LinuxCGroupHelper::GetCPUQuota(wxString* quotaDescription) const
+{
+    double minQuota = -1;
+
+    // the effective quota is the smallest one in the hierarchy
+    for ( wxString dir = GetControllerDir("cpu");
+          dir.length() >= (m_rootDir + "sys/fs/cgroup").length();
+          dir = dir.BeforeLast('/') )
+    {
+        wxLongLong_t quota = 0, period = 0;
+
+        if ( m_version == 2 )
+        {
+            // cpu.max contains "$MAX $PERIOD", where $MAX can be "max"
+            const wxString max = ReadLinuxFileLine(dir + "/cpu.max");
+
+            if ( !max.BeforeFirst(' ').ToLongLong(&quota) || !max.AfterFirst(' ').ToLongLong(&period) )
+                continue;
+        }
+        else
+        {
+            // cpu.cfs_quota_us is -1 when not limited
+            if ( !ReadLinuxFileLine(dir + "/cpu.cfs_quota_us").ToLongLong(&quota)
+                 || !ReadLinuxFileLine(dir + "/cpu.cfs_period_us").ToLongLong(&period) )
+            {
+                continue;
+            }
+        }
+
+        if ( quota <= 0 || period <= 0 )
+            continue;
+
+        const double CPUs = static_cast<double>(quota) / period;
+
+        if ( minQuota < 0 || CPUs < minQuota )
+        {
+            minQuota = CPUs;
+            if ( quotaDescription )
+                quotaDescription->Printf(_("%lld us per %lld us period"), quota, period);
+        }
+    }
+
+    return minQuota;
+}
+
+wxString LinuxCGroupHelper::GetCPUWeight() const
+{
+    if ( m_version == 2 )
+        return ReadControllerFile("cpu", "cpu.weight");
+
+    const wxString shares = ReadControllerFile("cpu", "cpu.shares");
+
+    if ( shares.empty() )
+        return wxEmptyString;
+    return wxString::Format(_("%s (shares)"), shares);
+}
+
+bool LinuxCGroupHelper::GetCPUStat(const wxString& name, wxULongLong_t& value) const
+{
+    const wxString dir = GetControllerDir("cpu");
+
+    if ( dir.empty() )
+        return false;
+
+    const auto stat = ParseLinuxNameValueFile(dir + "/cpu.stat", ' ');
+
+    if ( m_version == 2 )
+        return stat.count(name) && stat.at(name).ToULongLong(&value);
+
+    // v1 uses different names and nanoseconds
+    if ( name == "usage_usec" )
+    {
+        const wxString usage = ReadControllerFile("cpuacct", "cpuacct.usage");
+
+        if ( !usage.ToULongLong(&value) )
+            return false;
+        value /= 1000;
+        return true;
+    }
+
+    if ( name == "throttled_usec" )
+    {
+        if ( !stat.count("throttled_time") || !stat.at("throttled_time").ToULongLong(&value) )
+            return false;
+        value /= 1000;
+        return true;
+    }
+
+    return stat.count(name) && stat.at(name).ToULongLong(&value);
+}
+
+wxString LinuxCGroupHelper::MemoryValueToString(const wxString& value)
+{
+    wxULongLong_t bytes = 0;
+
+    if ( value.empty() )
+        return _("N/A");
+
+    // v1 uses a very large number, rounded to the page size, for no limit
+    if ( value == "max" || (value.ToULongLong(&bytes) && bytes >= (1ULL << 60)) )
+        return _("<Unlimited>");
+
+    if ( !value.ToULongLong(&bytes) )
+        return value;
+
+    return BytesToString(bytes);
+}
+
+wxString LinuxCGroupHelper::GetMemoryMax() const
+{
+    return MemoryValueToString(ReadControllerFile("memory", m_version == 2 ? "memory.max" : "memory.limit_in_bytes"));
+}
+
+wxString LinuxCGroupHelper::GetMemoryHigh() const
+{
+    return MemoryValueToString(ReadControllerFile("memory", m_version == 2 ? "memory.high" : "memory.soft_limit_in_bytes"));
+}
+
+wxString LinuxCGroupHelper::GetMemoryCurrent() const
+{
+    return MemoryValueToString(ReadControllerFile("memory", m_version == 2 ? "memory.current" : "memory.usage_in_bytes"));
+}
+
+wxString LinuxCGroupHelper::GetPIDsMax() const
+{
+    const wxString value = ReadControllerFile("pids", "pids.max");
+
+    if ( value.empty() )
+        return _("N/A");
+
+    return value == "max" ? _("<Unlimited>") : value;
+}
+
+wxString LinuxCGroupHelper::GetPIDsCurrent() const
+{
+    const wxString value = ReadControllerFile("pids", "pids.current");
+
+    return value.empty() ? _("N/A") : value;
+}
+
+wxString LinuxCGroupHelper::GetIOMax() const
+{
+    wxString contents;
+
+    if ( m_version == 2 )
+    {
+        // one line per device, e.g. "8:16 rbps=2097152 wbps=max riops=max wiops=120"
+        if ( !ReadLinuxFile(GetControllerDir("io") + "/io.max", contents) )
+            return _("N/A");
+    }
+    else
+    {
+        const wxString dir = GetControllerDir("blkio");
+
+        if ( dir.empty() )
+            return _("N/A");
+
+        for ( const auto& fileName : { "blkio.throttle.read_bps_device", "blkio.throttle.write_bps_device",
+                                       "blkio.throttle.read_iops_device", "blkio.throttle.write_iops_device" } )
+        {
+            const wxString line = ReadLinuxFileLine(dir + "/" + fileName);
+
+            if ( !line.empty() )
+                contents += wxString::Format("%s: %s\n", fileName, line);
+        }
+    }
+
+    contents.Trim();
+    contents.Replace("\n", "; ");
+
+    return contents.empty() ? _("<Unlimited>") : contents;
+}
+
+
+class CGroupView : public SysInfoListView
+{
+public:
+    CGroupView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+};
+
+CGroupView::CGroupView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void CGroupView::DoUpdateValues()
+{
+    const LinuxCGroupHelper cgroup;
+
+    std::vector<std::pair<wxString, wxString>> items;
+
+    if ( cgroup.GetVersion() == 0 )
+    {
+        items.emplace_back(_("CGroup Version"), _("<Unknown>"));
+        SetItemsWithValues(items);
+        return;
+    }
+
+    wxString quotaDescription;
+    const double quota = cgroup.GetCPUQuota(&quotaDescription);
+    const int hardwareCPUCount = wxThread::GetCPUCount();
+    std::set<long> affinity;
+    int effectiveCPUCount = hardwareCPUCount;
+    wxString effectiveCPUCountDescription;
+    wxULongLong_t usage = 0, periods = 0, throttledPeriods = 0, throttledTime = 0;
+
+    effectiveCPUCountDescription.Printf(_("hardware %d"), hardwareCPUCount);
+
+    if ( GetLinuxProcessCPUAffinity(affinity) )
+    {
+        effectiveCPUCount = std::min(effectiveCPUCount, static_cast<int>(affinity.size()));
+        effectiveCPUCountDescription += wxString::Format(_(", affinity %zu"), affinity.size());
+    }
+
+    if ( quota > 0 )
+    {
+        // a fractional quota still allows to use another CPU for a part of the period
+        effectiveCPUCount = std::min(effectiveCPUCount, std::max(1, static_cast<int>(std::ceil(quota))));
+        effectiveCPUCountDescription += wxString::Format(_(", quota %.2f"), quota);
+    }
+
+    items.emplace_back(_("CGroup Version"), cgroup.GetVersion() == 2 ? _("2 (unified)") : _("1 (legacy)"));
+    items.emplace_back(_("CGroup Path"), cgroup.GetPath());
+
+    items.emplace_back(_("CPU Quota"), quota < 0 ? _("<Unlimited>")
+        : wxString::Format(_("%.2f CPUs (%s)"), quota, quotaDescription));
+    items.emplace_back(_("CPU Weight"), cgroup.GetCPUWeight());
+    items.emplace_back(_("Effective CPU Count"),
+        wxString::Format(_("%d (%s)"), effectiveCPUCount, effectiveCPUCountDescription));
+
+    if ( cgroup.GetCPUStat("usage_usec", usage) )
+        items.emplace_back(_("CPU Usage"), wxString::Format(_("%.3f s"), usage / 1e6));
+    else
+        items.emplace_back(_("CPU Usage"), _("N/A"));
+
+    if ( cgroup.GetCPUStat("nr_periods", periods) && cgroup.GetCPUStat("nr_throttled", throttledPeriods) )
+    {
+        items.emplace_back(_("CPU Throttled Periods"), wxString::Format(_("%llu of %llu (%.1f%%)"),
+            throttledPeriods, periods, periods ? 100.0 * throttledPeriods / periods : 0.0));
+    }
+    else
+        items.emplace_back(_("CPU Throttled Periods"), _("N/A"));
+
+    if ( cgroup.GetCPUStat("throttled_usec", throttledTime) )
+        items.emplace_back(_("CPU Throttled Time"), wxString::Format(_("%.3f s"), throttledTime / 1e6));
+    else
+        items.emplace_back(_("CPU Throttled Time"), _("N/A"));
+
+    items.emplace_back(_("Memory Max"), cgroup.GetMemoryMax());
+    items.emplace_back(_("Memory High"), cgroup.GetMemoryHigh());
+    items.emplace_back(_("Memory Current"), cgroup.GetMemoryCurrent());
+    items.emplace_back(_("PIDs Max"), cgroup.GetPIDsMax());
+    items.emplace_back(_("PIDs Current"), cgroup.GetPIDsCurrent());
+    items.emplace_back(_("IO Max"), cgroup.GetIOMax());
+
+    SetItemsWithValues(items);
+}
+
+#endif // #ifdef __LINUX__
+
+
+/*************************************************
+
+    ProcessResourcesView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class ProcessResourcesView : public SampledSysInfoListView
+{
+public:
+    ProcessResourcesView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+        Column_History,
+    };
+
+    enum
+    {
+        Param_ResidentSetSize = 0,
+        Param_PeakResidentSetSize,
+        Param_VirtualSize,
+        Param_PeakVirtualSize,
+        Param_Swap,
+        Param_LockedMemory,
+        Param_MinorPageFaults,
+        Param_MajorPageFaults,
+        Param_VoluntaryContextSwitches,
+        Param_InvoluntaryContextSwitches,
+        Param_UserCPUTime,
+        Param_SystemCPUTime,
+        Param_CPUUsage,
+        Param_ThreadCount,
+        Param_FileDescriptorCount,
+    };
+
+    rusage m_previousUsage;
+    long   m_previousSampleTime{-1};
+
+    ListViewSparklines m_sparklines;
+};
+
+ProcessResourcesView::ProcessResourcesView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000),
+      m_sparklines(this, Column_History)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+    InsertColumn(Column_History, _("History"));
+
+    // the column has only the images
+    m_columnWidths[Column_History] = m_sparklines.GetImageSize().GetWidth() + 8;
+
+    AppendItemWithData(_("Resident Set Size (VmRSS)"), Param_ResidentSetSize);
+    AppendItemWithData(_("Peak Resident Set Size (VmHWM)"), Param_PeakResidentSetSize);
+    AppendItemWithData(_("Virtual Size (VmSize)"), Param_VirtualSize);
+    AppendItemWithData(_("Peak Virtual Size (VmPeak)"), Param_PeakVirtualSize);
+    AppendItemWithData(_("Swap (VmSwap)"), Param_Swap);
+    AppendItemWithData(_("Locked Memory (VmLck)"), Param_LockedMemory);
+    AppendItemWithData(_("Minor Page Faults"), Param_MinorPageFaults);
+    AppendItemWithData(_("Major Page Faults"), Param_MajorPageFaults);
+    AppendItemWithData(_("Voluntary Context Switches"), Param_VoluntaryContextSwitches);
+    AppendItemWithData(_("Involuntary Context Switches"), Param_InvoluntaryContextSwitches);
+    AppendItemWithData(_("User CPU Time"), Param_UserCPUTime);
+    AppendItemWithData(_("System CPU Time"), Param_SystemCPUTime);
+    AppendItemWithData(_("CPU Usage"), Param_CPUUsage);
+    AppendItemWithData(_("Thread Count"), Param_ThreadCount);
+    AppendItemWithData(_("Open File Descriptor Count"), Param_FileDescriptorCount);
+
+    memset(&m_previousUsage, 0, sizeof(m_previousUsage));
+
+    UpdateValues();
+}
+
+void ProcessResourcesView::DoUpdateValues()
+{
+    rusage usage;
+
+    if ( getrusage(RUSAGE_SELF, &usage) != 0 )
+    {
+        wxLogSysError(_("Could not obtain the process resource usage."));
+        memset(&usage, 0, sizeof(usage));
+    }
+
+    const auto status = ParseLinuxNameValueFile("/proc/self/status", ':');
+    const long sampleTime = GetSampleTime();
+    const double elapsedSeconds = m_previousSampleTime >= 0 ? (sampleTime - m_previousSampleTime) / 1000.0 : 0;
+    const long itemCount = GetStoredItemCount();
+
+    // the value shown in the history of the current row, if any
+    bool hasHistoryValue = false;
+    double historyValue = 0;
+
+    auto setHistoryValue = [&hasHistoryValue, &historyValue](double value)
+    {
+        hasHistoryValue = true;
+        historyValue = value;
+    };
+
+    // the memory values in /proc/self/status are in kB, e.g. "VmRSS:\t   10240 kB"
+    auto statusMemoryValue = [&status, &setHistoryValue](const char* name)
+    {
+        const auto it = status.find(name);
+        wxULongLong_t kiB = 0;
+
+        if ( it == status.end() || !it->second.BeforeFirst(' ').ToULongLong(&kiB) )
+            return _("N/A");
+
+        setHistoryValue(kiB);
+        return BytesToString(kiB * 1024);
+    };
+
+    // show the increment per second since the last sample as well
+    auto counterValue = [elapsedSeconds, &setHistoryValue](long current, long previous)
+    {
+        if ( elapsedSeconds <= 0 )
+            return wxString::Format("%ld", current);
+
+        setHistoryValue((current - previous) / elapsedSeconds);
+        return wxString::Format(_("%ld (%+.0f/s)"), current, (current - previous) / elapsedSeconds);
+    };
+
+    auto timevalToSeconds = [](const timeval& tv)
+    {
+        return tv.tv_sec + tv.tv_usec / 1e6;
+    };
+
+    for ( long i = 0; i < itemCount; ++i )
+    {
+        const long param = GetStoredItemData(i);
+        wxString value;
+
+        hasHistoryValue = false;
+
+        switch ( param )
+        {
+            case Param_ResidentSetSize:            value = statusMemoryValue("VmRSS"); break;
+            case Param_PeakResidentSetSize:        value = statusMemoryValue("VmHWM"); break;
+            case Param_VirtualSize:                value = statusMemoryValue("VmSize"); break;
+            case Param_PeakVirtualSize:            value = statusMemoryValue("VmPeak"); break;
+            case Param_Swap:                       value = statusMemoryValue("VmSwap"); break;
+            case Param_LockedMemory:               value = statusMemoryValue("VmLck"); break;
+            case Param_MinorPageFaults:            value = counterValue(usage.ru_minflt, m_previousUsage.ru_minflt); break;
+            case Param_MajorPageFaults:            value = counterValue(usage.ru_majflt, m_previousUsage.ru_majflt); break;
+            case Param_VoluntaryContextSwitches:   value = counterValue(usage.ru_nvcsw, m_previousUsage.ru_nvcsw); break;
+            case Param_InvoluntaryContextSwitches: value = counterValue(usage.ru_nivcsw, m_previousUsage.ru_nivcsw); break;
+            case Param_UserCPUTime:                value.Printf(_("%.3f s"), timevalToSeconds(usage.ru_utime)); break;
+            case Param_SystemCPUTime:              value.Printf(_("%.3f s"), timevalToSeconds(usage.ru_stime)); break;
+            case Param_CPUUsage:
+                if ( elapsedSeconds > 0 )
+                {
+                    const double CPUSeconds = timevalToSeconds(usage.ru_utime) + timevalToSeconds(usage.ru_stime)
+                                              - timevalToSeconds(m_previousUsage.ru_utime) - timevalToSeconds(m_previousUsage.ru_stime);
+
+                    // can be over 100% when more threads are running
+                    value.Printf(_("%.1f%%"), 100 * CPUSeconds / elapsedSeconds);
+                    setHistoryValue(CPUSeconds / elapsedSeconds);
+                }
+                else
+                    value = _("<Evaluating...>");
+                break;
+            case Param_ThreadCount:
+            {
+                long threadCount = 0;
+
+                value = status.count("Threads") ? status.at("Threads") : _("N/A");
+                if ( value.ToLong(&threadCount) )
+                    setHistoryValue(threadCount);
+                break;
+            }
+            case Param_FileDescriptorCount:
+            {
+                const long count = GetLinuxDirEntryCount("/proc/self/fd");
+
+                // opening the directory itself uses one descriptor
+                value = count > 0 ? wxString::Format("%ld", count - 1) : _("N/A");
+                if ( count > 0 )
+                    setHistoryValue(count - 1);
+                break;
+            }
+
+            default:
+                wxFAIL;
+        }
+
+        SetStoredItem(i, Column_Value, value);
+
+        if ( hasHistoryValue )
+            m_sparklines.AddValue(param, historyValue);
+    }
+
+    m_sparklines.Update();
+
+    m_previousUsage = usage;
+    m_previousSampleTime = sampleTime;
+}
+
+#endif // #ifdef __LINUX__
+
+
+/*************************************************
+
+    LinuxMemoryView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class LinuxMemoryView : public SysInfoListView
+{
+public:
+    LinuxMemoryView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    void AppendMemInfoValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendVMStatValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendHugePagesValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendVMSysctlValues(std::vector<std::pair<wxString, wxString>>& items);
+};
+
+LinuxMemoryView::LinuxMemoryView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void LinuxMemoryView::DoUpdateValues()
+{
+    std::vector<std::pair<wxString, wxString>> items;
+
+    AppendMemInfoValues(items);
+    AppendHugePagesValues(items);
+    AppendVMSysctlValues(items);
+    AppendVMStatValues(items);
+
+    SetItemsWithValues(items);
+}
+
+// unlike ParseLinuxMemInfo(), keeps the order of the values in the file
+void LinuxMemoryView::AppendMemInfoValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    wxString contents;
+
+    if ( !ReadLinuxFile("/proc/meminfo", contents) )
+    {
+        wxLogError(_("Could not read \"%s\"."), "/proc/meminfo");
+        return;
+    }
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        wxString valueAndUnit;
+        const wxString name = line.BeforeFirst(':', &valueAndUnit);
+        wxString unit;
+        const wxString value = valueAndUnit.Trim(false).BeforeFirst(' ', &unit);
+        wxULongLong_t number = 0;
+
+        if ( name.empty() )
+            continue;
+
+        if ( unit == "kB" && value.ToULongLong(&number) )
+            items.emplace_back(name, BytesToString(number * 1024));
+        else
+            items.emplace_back(name, valueAndUnit);
+    }
+}
+
+void LinuxMemoryView::AppendHugePagesValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const wxString THPDir("/sys/kernel/mm/transparent_hugepage/");
+    static const wxString hugePagesDir("/sys/kernel/mm/hugepages/");
+
+    wxULongLong_t PMDSize = 0;
+
+    items.emplace_back(_("Transparent Huge Pages Enabled"), GetLinuxSelectedOption(ReadLinuxFileLine(THPDir + "enabled")));
+    items.emplace_back(_("Transparent Huge Pages Defrag"), GetLinuxSelectedOption(ReadLinuxFileLine(THPDir + "defrag")));
+    items.emplace_back(_("Transparent Huge Pages Shmem Enabled"), GetLinuxSelectedOption(ReadLinuxFileLine(THPDir + "shmem_enabled")));
+    if ( ReadLinuxFileLine(THPDir + "hpage_pmd_size").ToULongLong(&PMDSize) )
+        items.emplace_back(_("Transparent Huge Page Size"), BytesToString(PMDSize));
+
+    // there is a directory for each supported huge page size, e.g., "hugepages-2048kB"
+    for ( const auto& poolName : GetLinuxDirEntries(hugePagesDir, "hugepages-") )
+    {
+        const wxString poolDir = hugePagesDir + poolName + "/";
+
+        items.emplace_back(wxString::Format(_("Huge Page Pool %s"), poolName.AfterFirst('-')),
+            wxString::Format(_("Total %s, Free %s, Reserved %s, Surplus %s, Overcommit %s"),
+                             ReadLinuxFileLine(poolDir + "nr_hugepages"),
+                             ReadLinuxFileLine(poolDir + "free_hugepages"),
+                             ReadLinuxFileLine(poolDir + "resv_hugepages"),
+                             ReadLinuxFileLine(poolDir + "surplus_hugepages"),
+                             ReadLinuxFileLine(poolDir + "nr_overcommit_hugepages")));
+    }
+}
+
+void LinuxMemoryView::AppendVMSysctlValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const char* sysctlNames[] =
+    {
+        "swappiness",
+        "overcommit_memory",
+        "overcommit_ratio",
+        "overcommit_kbytes",
+        "min_free_kbytes",
+        "dirty_ratio",
+        "dirty_background_ratio",
+        "vfs_cache_pressure",
+        "zone_reclaim_mode",
+        "max_map_count",
+    };
+
+    for ( const auto& sysctlName : sysctlNames )
+    {
+        const wxString fileName = wxString("/proc/sys/vm/") + sysctlName;
+        wxString value;
+
+        // not all the sysctls are available on all kernel versions
+        if ( !ReadLinuxFile(fileName, value) )
+            continue;
+
+        value = value.BeforeFirst('\n').Trim();
+
+        if ( strcmp(sysctlName, "overcommit_memory") == 0 )
+        {
+            if ( value == "0" )
+                value += _(" (Heuristic)");
+            else if ( value == "1" )
+                value += _(" (Always)");
+            else if ( value == "2" )
+                value += _(" (Never)");
+        }
+
+        items.emplace_back(wxString("vm.") + sysctlName, value);
+    }
+}
+
+void LinuxMemoryView::AppendVMStatValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const char* counterNames[] =
+    {
+        "pgfault",
+        "pgmajfault",
+        "pswpin",
+        "pswpout",
+        "pgscan_kswapd",
+        "pgscan_direct",
+        "pgsteal_kswapd",
+        "pgsteal_direct",
+        "allocstall_normal",
+        "allocstall_movable",
+        "compact_stall",
+        "compact_fail",
+        "compact_success",
+        "thp_fault_alloc",
+        "thp_fault_fallback",
+        "thp_collapse_alloc",
+        "thp_split_page",
+        "numa_hit",
+        "numa_miss",
+        "numa_foreign",
+        "oom_kill",
+    };
+
+    const auto counters = ParseLinuxNameValueFile("/proc/vmstat", ' ');
+
+    for ( const auto& counterName : counterNames )
+    {
+        const auto it = counters.find(counterName);
+
+        if ( it != counters.end() )
+            items.emplace_back(wxString("vmstat ") + counterName, it->second);
+    }
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    PressureView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+// Pressure Stall Information, see https://docs.kernel.org/accounting/psi.html
+class PressureView : public SampledSysInfoListView
+{
+public:
+    PressureView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+        Column_History,
+    };
+
+    enum
+    {
+        Param_CPUSome = 0,
+        Param_CPUFull,
+        Param_MemorySome,
+        Param_MemoryFull,
+        Param_IOSome,
+        Param_IOFull,
+        Param_LoadAverage,
+        Param_Tasks,
+    };
+
+    std::map<long, wxULongLong_t> m_previousTotals; // param, stall microseconds
+    long m_previousSampleTime{-1};
+
+    ListViewSparklines m_sparklines;
+
+    wxString GetPressureValue(long param, const std::map<wxString, wxString>& fields, double elapsedSeconds);
+
+    // returns the fields for the "some" or "full" line of a /proc/pressure file
+    static std::map<wxString, wxString> ParsePressureLine(const wxString& contents, const wxString& kind);
+};
+
+PressureView::PressureView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000),
+      m_sparklines(this, Column_History)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+    InsertColumn(Column_History, _("History"));
+
+    // the column has only the images
+    m_columnWidths[Column_History] = m_sparklines.GetImageSize().GetWidth() + 8;
+
+    AppendItemWithData(_("CPU Some"), Param_CPUSome);
+    AppendItemWithData(_("CPU Full"), Param_CPUFull);
+    AppendItemWithData(_("Memory Some"), Param_MemorySome);
+    AppendItemWithData(_("Memory Full"), Param_MemoryFull);
+    AppendItemWithData(_("IO Some"), Param_IOSome);
+    AppendItemWithData(_("IO Full"), Param_IOFull);
+    AppendItemWithData(_("Load Average (1, 5, 15 min)"), Param_LoadAverage);
+    AppendItemWithData(_("Runnable / Total Tasks"), Param_Tasks);
+
+    UpdateValues();
+}
+
+void PressureView::DoUpdateValues()
+{
+    const long sampleTime = GetSampleTime();
+    const double elapsedSeconds = m_previousSampleTime >= 0 ? (sampleTime - m_previousSampleTime) / 1000.0 : 0;
+    const long itemCount = GetStoredItemCount();
+    wxString CPUPressure, memoryPressure, IOPressure, loadAverage;
+
+    ReadLinuxFile("/proc/pressure/cpu", CPUPressure);
+    ReadLinuxFile("/proc/pressure/memory", memoryPressure);
+    ReadLinuxFile("/proc/pressure/io", IOPressure);
+    loadAverage = ReadLinuxFileLine("/proc/loadavg");
+
+    // e.g. "0.52 0.58 0.59 1/1234 5678"
+    const wxArrayString loadAverageFields = wxSplit(loadAverage, ' ', '\0');
+
+    for ( long i = 0; i < itemCount; ++i )
+    {
+        const long param = GetStoredItemData(i);
+        wxString value;
+
+        switch ( param )
+        {
+            case Param_CPUSome:    value = GetPressureValue(param, ParsePressureLine(CPUPressure, "some"), elapsedSeconds); break;
+            case Param_CPUFull:    value = GetPressureValue(param, ParsePressureLine(CPUPressure, "full"), elapsedSeconds); break;
+            case Param_MemorySome: value = GetPressureValue(param, ParsePressureLine(memoryPressure, "some"), elapsedSeconds); break;
+            case Param_MemoryFull: value = GetPressureValue(param, ParsePressureLine(memoryPressure, "full"), elapsedSeconds); break;
+            case Param_IOSome:     value = GetPressureValue(param, ParsePressureLine(IOPressure, "some"), elapsedSeconds); break;
+            case Param_IOFull:     value = GetPressureValue(param, ParsePressureLine(IOPressure, "full"), elapsedSeconds); break;
+            case Param_LoadAverage:
+            {
+                double load = 0;
+
+                if ( loadAverageFields.size() < 3 || !loadAverageFields[0].ToCDouble(&load) )
+                {
+                    value = _("N/A");
+                    break;
+                }
+
+                value.Printf("%s, %s, %s", loadAverageFields[0], loadAverageFields[1], loadAverageFields[2]);
+                m_sparklines.AddValue(param, load);
+                break;
+            }
+            case Param_Tasks:
+                value = loadAverageFields.size() > 3 ? loadAverageFields[3] : _("N/A");
+                break;
+
+            default:
+                wxFAIL;
+        }
+
+        SetStoredItem(i, Column_Value, value);
+    }
+
+    m_sparklines.Update();
+    m_previousSampleTime = sampleTime;
+}
+
+// e.g. "avg10=0.00 avg60=0.00 avg300=0.00 total=12345"
+wxString PressureView::GetPressureValue(long param, const std::map<wxString, wxString>& fields, double elapsedSeconds)
+{
+    wxULongLong_t total = 0;
+
+    if ( !fields.count("total") || !fields.at("total").ToULongLong(&total) )
+        return _("N/A");
+
+    wxString value = wxString::Format(_("avg10 %s%%, avg60 %s%%, avg300 %s%%, total %llu us"),
+                                      fields.count("avg10") ? fields.at("avg10") : wxString(),
+                                      fields.count("avg60") ? fields.at("avg60") : wxString(),
+                                      fields.count("avg300") ? fields.at("avg300") : wxString(),
+                                      total);
+
+    const auto it = m_previousTotals.find(param);
+
+    // the share of the time stalled since the previous sample
+    if ( it != m_previousTotals.end() && elapsedSeconds > 0 )
+    {
+        const double stalledPercent = (total - it->second) / 1e4 / elapsedSeconds;
+
+        value += wxString::Format(_(" (+%llu us, %.2f%% stalled)"), total - it->second, stalledPercent);
+        m_sparklines.AddValue(param, stalledPercent);
+    }
+
+    m_previousTotals[param] = total;
+
+    return value;
+}
+
+std::map<wxString, wxString> PressureView::ParsePressureLine(const wxString& contents, const wxString& kind)
+{
+    std::map<wxString, wxString> fields;
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        wxString rest;
+
+        if ( !line.StartsWith(kind + " ", &rest) )
+            continue;
+
+        for ( const auto& field : wxSplit(rest, ' ', '\0') )
+        {
+            wxString fieldValue;
+            const wxString fieldName = field.BeforeFirst('=', &fieldValue);
+
+            if ( !fieldName.empty() )
+                fields[fieldName] = fieldValue;
+        }
+    }
+
+    return fields;
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    CPUUsageView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class CPUUsageView : public SampledSysInfoListView
+{
+public:
+    CPUUsageView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_CPU = 0,
+        Column_Usage,
+        Column_User,
+        Column_System,
+        Column_IOWait,
+        Column_Steal,
+        Column_Frequency,
+        Column_Governor,
+        Column_EnergyPerformancePreference,
+    };
+
+    // in USER_HZ units, as in /proc/stat
+    struct CPUTimes
+    {
+        wxULongLong_t total{0};
+        wxULongLong_t idle{0};
+        wxULongLong_t user{0};
+        wxULongLong_t system{0};
+        wxULongLong_t IOWait{0};
+        wxULongLong_t steal{0};
+    };
+
+    // the CPU number is -1 for the line with the times of all CPUs
+    std::map<long, CPUTimes> m_previousTimes;
+
+    // returns the times in the order of /proc/stat
+    static std::vector<std::pair<long, CPUTimes>> ReadCPUTimes();
+    static wxString GetFrequency(long CPU);
+};
+
+CPUUsageView::CPUUsageView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000)
+{
+    InsertColumn(Column_CPU, _("CPU"));
+    InsertColumn(Column_Usage, _("Usage"));
+    InsertColumn(Column_User, _("User"));
+    InsertColumn(Column_System, _("System"));
+    InsertColumn(Column_IOWait, _("IO Wait"));
+    InsertColumn(Column_Steal, _("Steal"));
+    InsertColumn(Column_Frequency, _("Frequency (Min-Max)"));
+    InsertColumn(Column_Governor, _("Governor"));
+    InsertColumn(Column_EnergyPerformancePreference, _("Energy Performance Preference"));
+
+    UpdateValues();
+}
+
+void CPUUsageView::DoUpdateValues()
+{
+    const auto times = ReadCPUTimes();
+    bool rebuildItems = static_cast<size_t>(GetStoredItemCount()) != times.size();
+
+    for ( size_t i = 0; !rebuildItems && i < times.size(); ++i )
+        rebuildItems = static_cast<long>(GetStoredItemData(i)) != times[i].first;
+
+    // CPUs can be brought online or offline
+    if ( rebuildItems )
+    {
+        DeleteAllStoredItems();
+
+        for ( const auto& CPUAndTimes : times )
+        {
+            const long CPU = CPUAndTimes.first;
+
+            AppendItemWithData(CPU == -1 ? _("All") : wxString::Format("%ld", CPU), CPU);
+        }
+    }
+
+    for ( size_t i = 0; i < times.size(); ++i )
+    {
+        const long CPU = times[i].first;
+        const CPUTimes& current = times[i].second;
+        const auto previousIt = m_previousTimes.find(CPU);
+
+        if ( previousIt != m_previousTimes.end() && current.total > previousIt->second.total )
+        {
+            const CPUTimes& previous = previousIt->second;
+            const double total = current.total - previous.total;
+
+            auto percent = [total](wxULongLong_t currentTime, wxULongLong_t previousTime)
+            {
+                // the counters of an offlined CPU can go back
+                if ( currentTime < previousTime )
+                    return wxString(_("N/A"));
+
+                return wxString::Format(_("%.1f%%"), 100 * (currentTime - previousTime) / total);
+            };
+
+            // idle includes iowait, which can go back too
+            if ( current.idle < previous.idle )
+                SetStoredItem(i, Column_Usage, _("N/A"));
+            else
+                SetStoredItem(i, Column_Usage, wxString::Format(_("%.1f%%"),
+                    std::max(0.0, 100 - 100 * (current.idle - previous.idle) / total)));
+            SetStoredItem(i, Column_User, percent(current.user, previous.user));
+            SetStoredItem(i, Column_System, percent(current.system, previous.system));
+            SetStoredItem(i, Column_IOWait, percent(current.IOWait, previous.IOWait));
+            SetStoredItem(i, Column_Steal, percent(current.steal, previous.steal));
+        }
+        else
+        {
+            SetStoredItem(i, Column_Usage, _("<Evaluating...>"));
+        }
+
+        if ( CPU != -1 )
+        {
+            const wxString CPUFreqDir = wxString::Format("/sys/devices/system/cpu/cpu%ld/cpufreq/", CPU);
+
+            SetStoredItem(i, Column_Frequency, GetFrequency(CPU));
+            SetStoredItem(i, Column_Governor, ReadLinuxFileLine(CPUFreqDir + "scaling_governor"));
+            SetStoredItem(i, Column_EnergyPerformancePreference, ReadLinuxFileLine(CPUFreqDir + "energy_performance_preference"));
+        }
+
+        m_previousTimes[CPU] = current;
+    }
+}
+
+// see proc(5) for the description of /proc/stat lines, such as
+// "cpu0 4705 356 584 3699 23 23 0 0 0 0" (user nice system idle iowait irq softirq steal guest guest_nice)
+std::vector<std::pair<long, CPUUsageView::CPUTimes>> CPUUsageView::ReadCPUTimes()
+{
+    std::vector<std::pair<long, CPUTimes>> times;
+    wxString contents;
+
+    if ( !ReadLinuxFile("/proc/stat", contents) )
+    {
+        wxLogError(_("Could not read \"%s\"."), "/proc/stat");
+        return times;
+    }
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        wxString rest;
+
+        if ( !line.StartsWith("cpu", &rest) )
+            continue;
+
+        // the line with the times of all CPUs starts with "cpu" followed by two spaces
+        wxString timeFields;
+        const wxString CPUNumber = rest.BeforeFirst(' ', &timeFields);
+        const wxArrayString fields = wxSplit(timeFields.Trim(false), ' ', '\0');
+        std::vector<wxULongLong_t> values;
+        long CPU = -1;
+        CPUTimes lineTimes;
+
+        if ( fields.size() < 8 || (!CPUNumber.empty() && !CPUNumber.ToLong(&CPU)) )
+            continue;
+
+        for ( size_t i = 0; i < 8; ++i )
+        {
+            wxULongLong_t value = 0;
+
+            fields[i].ToULongLong(&value);
+            values.push_back(value);
+        }
+
+        // guest times are already included in the user times
+        for ( const auto value : values )
+            lineTimes.total += value;
+
+        lineTimes.user   = values[0] + values[1];
+        lineTimes.system = values[2] + values[5] + values[6];
+        lineTimes.idle   = values[3] + values[4];
+        lineTimes.IOWait = values[4];
+        lineTimes.steal  = values[7];
+
+        times.emplace_back(CPU, lineTimes);
+    }
+
+    return times;
+}
+
+wxString CPUUsageView::GetFrequency(long CPU)
+{
+    const wxString CPUFreqDir = wxString::Format("/sys/devices/system/cpu/cpu%ld/cpufreq/", CPU);
+    long current = 0, min = 0, max = 0;
+
+    // the values are in kHz
+    if ( !ReadLinuxFileLine(CPUFreqDir + "scaling_cur_freq").ToLong(&current) )
+        return _("N/A");
+
+    if ( ReadLinuxFileLine(CPUFreqDir + "scaling_min_freq").ToLong(&min)
+         && ReadLinuxFileLine(CPUFreqDir + "scaling_max_freq").ToLong(&max) )
+    {
+        return wxString::Format(_("%ld MHz (%ld-%ld)"), current / 1000, min / 1000, max / 1000);
+    }
+
+    return wxString::Format(_("%ld MHz"), current / 1000);
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    KernelView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+// Kernel settings affecting performance: CPU vulnerability mitigations,
+// boot parameters, scheduler tunables, and clocksource.
+class KernelView : public SysInfoListView
+{
+public:
+    KernelView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    void AppendCommandLineValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendVulnerabilitiesValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendSchedulerValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendClocksourceValues(std::vector<std::pair<wxString, wxString>>& items);
+};
+
+KernelView::KernelView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void KernelView::DoUpdateValues()
+{
+    std::vector<std::pair<wxString, wxString>> items;
+
+    items.emplace_back(_("Kernel Release"), ReadLinuxFileLine("/proc/sys/kernel/osrelease"));
+    AppendCommandLineValues(items);
+    AppendVulnerabilitiesValues(items);
+    AppendClocksourceValues(items);
+    AppendSchedulerValues(items);
+
+    SetItemsWithValues(items);
+}
+
+void KernelView::AppendCommandLineValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    // boot parameters affecting performance, their presence is shown even when not set
+    static const char* parameterNames[] =
+    {
+        "mitigations",
+        "isolcpus",
+        "nohz_full",
+        "rcu_nocbs",
+        "irqaffinity",
+        "nosmt",
+        "preempt",
+        "clocksource",
+        "tsc",
+        "intel_pstate",
+        "amd_pstate",
+        "intel_idle.max_cstate",
+        "processor.max_cstate",
+        "idle",
+        "transparent_hugepage",
+        "default_hugepagesz",
+        "hugepages",
+        "numa_balancing",
+    };
+
+    const wxString commandLine = ReadLinuxFileLine("/proc/cmdline");
+    std::map<wxString, wxString> parameters;
+
+    items.emplace_back(_("Command Line"), commandLine);
+
+    // parameters without a value, such as "nosmt", are stored with an empty one
+    for ( const auto& parameter : wxSplit(commandLine, ' ', '\0') )
+    {
+        wxString value;
+        const wxString name = parameter.BeforeFirst('=', &value);
+
+        if ( !name.empty() )
+            parameters[name] = value;
+    }
+
+    for ( const auto& parameterName : parameterNames )
+    {
+        const auto it = parameters.find(parameterName);
+        wxString value;
+
+        if ( it == parameters.end() )
+            value = _("<Not Set>");
+        else if ( it->second.empty() )
+            value = _("<Set>");
+        else
+            value = it->second;
+
+        items.emplace_back(wxString::Format(_("Command Line %s"), parameterName), value);
+    }
+}
+
+void KernelView::AppendVulnerabilitiesValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const wxString vulnerabilitiesDir("/sys/devices/system/cpu/vulnerabilities/");
+
+    for ( const auto& vulnerability : GetLinuxDirEntries(vulnerabilitiesDir, "") )
+    {
+        items.emplace_back(wxString::Format(_("Vulnerability %s"), vulnerability),
+                           ReadLinuxFileLine(vulnerabilitiesDir + vulnerability));
+    }
+}
+
+void KernelView::AppendClocksourceValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const wxString clocksourceDir("/sys/devices/system/clocksource/clocksource0/");
+
+    items.emplace_back(_("Current Clocksource"), ReadLinuxFileLine(clocksourceDir + "current_clocksource"));
+    items.emplace_back(_("Available Clocksources"), ReadLinuxFileLine(clocksourceDir + "available_clocksource"));
+}
+
+void KernelView::AppendSchedulerValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const wxString kernelSysctlDir("/proc/sys/kernel/");
+
+    std::vector<wxString> sysctlNames = GetLinuxDirEntries(kernelSysctlDir, "sched_");
+
+    sysctlNames.push_back("numa_balancing");
+
+    for ( const auto& sysctlName : sysctlNames )
+    {
+        wxString value;
+
+        // skip the directories, such as sched_domain, and unavailable sysctls
+        if ( !ReadLinuxFile(kernelSysctlDir + sysctlName, value) || value.empty() )
+            continue;
+
+        // some sysctls, e.g. sched_rr_timeslice_ms, can span more lines
+        value.Trim();
+        value.Replace("\n", "; ");
+        value.Replace("\t", " ");
+
+        items.emplace_back("kernel." + sysctlName, value);
+    }
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    ResourceLimitsView
+
+*************************************************/
+
+#ifdef __UNIX__
+
+class ResourceLimitsView : public SysInfoListView
+{
+public:
+    ResourceLimitsView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Resource = 0,
+        Column_SoftLimit,
+        Column_HardLimit,
+        Column_Usage,
+    };
+
+    enum Unit
+    {
+        Unit_Count,
+        Unit_Bytes,
+        Unit_Seconds,
+        Unit_Microseconds,
+    };
+
+    // process values used for the current usage of some resources
+    std::map<wxString, wxString> m_processStatus;
+    rusage                       m_processUsage{};
+
+    // statusName is the name of the value in /proc/self/status with the current usage
+    void AppendResourceLimit(std::vector<std::pair<long, wxArrayString>>& items, int resource, const wxString& resourceName,
+                             const wxString& description, Unit unit, const char* statusName);
+    wxString GetUsage(int resource, const char* statusName) const;
+
+    static wxString LimitToString(rlim_t limit, Unit unit);
+};
+
+ResourceLimitsView::ResourceLimitsView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Resource, _("Resource"));
+    InsertColumn(Column_SoftLimit, _("Soft Limit"));
+    InsertColumn(Column_HardLimit, _("Hard Limit"));
+    InsertColumn(Column_Usage, _("Current Usage"));
+
+    UpdateValues();
+}
+
+#define APPEND_RESOURCE_LIMIT_ITEM(resource, description, unit, statusName) \
+    AppendResourceLimit(items, resource, #resource, description, unit, statusName);
+
+void ResourceLimitsView::DoUpdateValues()
+{
+    std::vector<std::pair<long, wxArrayString>> items;
+
+#ifdef __LINUX__
+    m_processStatus = ParseLinuxNameValueFile("/proc/self/status", ':');
+#endif
+    if ( getrusage(RUSAGE_SELF, &m_processUsage) != 0 )
+        m_processUsage = rusage();
+
+#ifdef RLIMIT_AS
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_AS, _("Address Space"), Unit_Bytes, "VmSize")
+#endif
+#ifdef RLIMIT_CORE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_CORE, _("Core File Size"), Unit_Bytes, nullptr)
+#endif
+#ifdef RLIMIT_CPU
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_CPU, _("CPU Time"), Unit_Seconds, nullptr)
+#endif
+#ifdef RLIMIT_DATA
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_DATA, _("Data Segment Size"), Unit_Bytes, "VmData")
+#endif
+#ifdef RLIMIT_FSIZE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_FSIZE, _("File Size"), Unit_Bytes, nullptr)
+#endif
+#ifdef RLIMIT_KQUEUES
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_KQUEUES, _("Kqueues"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_LOCKS
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_LOCKS, _("File Locks"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_MEMLOCK
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_MEMLOCK, _("Locked Memory"), Unit_Bytes, "VmLck")
+#endif
+#ifdef RLIMIT_MSGQUEUE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_MSGQUEUE, _("POSIX Message Queues"), Unit_Bytes, nullptr)
+#endif
+#ifdef RLIMIT_NICE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_NICE, _("Nice Ceiling"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_NOFILE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_NOFILE, _("Open Files"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_NPROC
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_NPROC, _("Processes"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_NPTS
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_NPTS, _("Pseudo-terminals"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_RSS
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_RSS, _("Resident Set Size"), Unit_Bytes, "VmRSS")
+#endif
+#ifdef RLIMIT_RTPRIO
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_RTPRIO, _("Real-Time Priority"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_RTTIME
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_RTTIME, _("Real-Time CPU Time"), Unit_Microseconds, nullptr)
+#endif
+#ifdef RLIMIT_SBSIZE
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_SBSIZE, _("Socket Buffer Size"), Unit_Bytes, nullptr)
+#endif
+#ifdef RLIMIT_SIGPENDING
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_SIGPENDING, _("Pending Signals"), Unit_Count, nullptr)
+#endif
+#ifdef RLIMIT_STACK
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_STACK, _("Stack Size"), Unit_Bytes, "VmStk")
+#endif
+#ifdef RLIMIT_SWAP
+    APPEND_RESOURCE_LIMIT_ITEM(RLIMIT_SWAP, _("Swap"), Unit_Bytes, nullptr)
+#endif
+
+    SetStoredItems(items);
+}
+
+void ResourceLimitsView::AppendResourceLimit(std::vector<std::pair<long, wxArrayString>>& items, int resource, const wxString& resourceName,
+                                             const wxString& description, Unit unit, const char* statusName)
+{
+    wxArrayString columns;
+    rlimit limit;
+
+    columns.push_back(wxString::Format("%s (%s)", resourceName, description));
+
+    if ( getrlimit(resource, &limit) == 0 )
+    {
+        columns.push_back(LimitToString(limit.rlim_cur, unit));
+        columns.push_back(LimitToString(limit.rlim_max, unit));
+    }
+    else
+    {
+        columns.push_back(_("<Error>"));
+        columns.push_back(_("<Error>"));
+    }
+
+    columns.push_back(GetUsage(resource, statusName));
+
+    items.emplace_back(resource, columns);
+}
+
+wxString ResourceLimitsView::GetUsage(int resource, const char* statusName) const
+{
+    if ( statusName )
+    {
+        // the memory values in /proc/self/status are in kB, e.g. "VmRSS:\t   10240 kB"
+        const auto it = m_processStatus.find(statusName);
+        wxULongLong_t kiB = 0;
+
+        if ( it != m_processStatus.end() && it->second.BeforeFirst(' ').ToULongLong(&kiB) )
+            return BytesToString(kiB * 1024);
+
+        return wxEmptyString;
+    }
+
+    switch ( resource )
+    {
+#ifdef RLIMIT_CPU
+        case RLIMIT_CPU:
+            return wxString::Format(_("%ld s"), static_cast<long>(m_processUsage.ru_utime.tv_sec + m_processUsage.ru_stime.tv_sec));
+#endif
+
+#ifdef __LINUX__
+    #ifdef RLIMIT_NOFILE
+        case RLIMIT_NOFILE:
+        {
+            const long count = GetLinuxDirEntryCount("/proc/self/fd");
+
+            // opening the directory itself uses one descriptor
+            return count > 0 ? wxString::Format("%ld", count - 1) : wxString();
+        }
+    #endif
+    #ifdef RLIMIT_NPROC
+        // the limit applies to all threads of the user, only this process is shown
+        case RLIMIT_NPROC:
+        {
+            const auto it = m_processStatus.find("Threads");
+
+            return it != m_processStatus.end() ? wxString::Format(_("%s threads in this process"), it->second) : wxString();
+        }
+    #endif
+    #ifdef RLIMIT_SIGPENDING
+        // e.g. "SigQ:\t0/63414", queued signals of the user / limit
+        case RLIMIT_SIGPENDING:
+        {
+            const auto it = m_processStatus.find("SigQ");
+
+            return it != m_processStatus.end() ? it->second.BeforeFirst('/') : wxString();
+        }
+    #endif
+#endif // #ifdef __LINUX__
+    }
+
+    return wxEmptyString;
+}
+
+wxString ResourceLimitsView::LimitToString(rlim_t limit, Unit unit)
+{
+    if ( limit == RLIM_INFINITY )
+        return _("Unlimited");
+
+    switch ( unit )
+    {
+        case Unit_Bytes:        return BytesToString(limit);
+        case Unit_Seconds:      return wxString::Format(_("%llu s"), static_cast<wxULongLong_t>(limit));
+        case Unit_Microseconds: return wxString::Format(_("%llu us"), static_cast<wxULongLong_t>(limit));
+        default:                return wxString::Format("%llu", static_cast<wxULongLong_t>(limit));
+    }
+}
+
+#endif // #ifdef __UNIX__
+
+/*************************************************
+
+    StorageView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+// Mounted filesystems and block devices.
+class StorageView : public SysInfoListView
+{
+public:
+    StorageView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    void AppendMountValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendBlockDeviceValues(std::vector<std::pair<wxString, wxString>>& items);
+};
+
+StorageView::StorageView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void StorageView::DoUpdateValues()
+{
+    std::vector<std::pair<wxString, wxString>> items;
+
+    AppendMountValues(items);
+    AppendBlockDeviceValues(items);
+
+    SetItemsWithValues(items);
+}
+
+void StorageView::AppendMountValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    for ( const auto& mount : ParseLinuxMountInfo() )
+    {
+        if ( IsLinuxPseudoFilesystem(mount.type) )
+            continue;
+
+        // statvfs() could block the GUI thread or trigger mounting
+        if ( IsLinuxRemoteOrAutoFilesystem(mount.type) )
+        {
+            items.emplace_back(wxString::Format(_("Mount %s"), mount.mountPoint),
+                wxString::Format(_("%s on %s (%s); space not queried for network, FUSE and automounted filesystems"),
+                                 mount.type, mount.source, mount.options));
+            continue;
+        }
+
+        struct statvfs fs;
+
+        // skip other filesystems without blocks
+        if ( statvfs(mount.mountPoint.fn_str(), &fs) != 0 || fs.f_blocks == 0 )
+            continue;
+
+        const wxULongLong_t totalSize = static_cast<wxULongLong_t>(fs.f_blocks) * fs.f_frsize;
+        const wxULongLong_t freeSize = static_cast<wxULongLong_t>(fs.f_bfree) * fs.f_frsize;
+        const wxULongLong_t availableSize = static_cast<wxULongLong_t>(fs.f_bavail) * fs.f_frsize;
+        wxString value;
+
+        value.Printf(_("%s on %s (%s); %s available of %s, %.0f%% used"),
+                     mount.type, mount.source, mount.options,
+                     BytesToString(availableSize), BytesToString(totalSize),
+                     100.0 * (totalSize - freeSize) / totalSize);
+
+        // some filesystems, e.g. btrfs, do not have a fixed number of inodes
+        if ( fs.f_files > 0 )
+            value += wxString::Format(_("; inodes %.0f%% used"), 100.0 * (fs.f_files - fs.f_ffree) / fs.f_files);
+
+        items.emplace_back(wxString::Format(_("Mount %s"), mount.mountPoint), value);
+    }
+}
+
+void StorageView::AppendBlockDeviceValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    static const wxString blockDir("/sys/block/");
+
+    std::map<wxString, wxArrayString> diskStats; // device name, the fields after the name
+    wxString contents;
+
+    // see https://docs.kernel.org/admin-guide/iostats.html for the fields
+    if ( ReadLinuxFile("/proc/diskstats", contents) )
+    {
+        for ( const auto& line : wxSplit(contents, '\n', '\0') )
+        {
+            wxArrayString fields;
+
+            for ( const auto& field : wxSplit(line, ' ', '\0') )
+            {
+                if ( !field.empty() )
+                    fields.push_back(field);
+            }
+
+            if ( fields.size() >= 14 )
+                diskStats[fields[2]] = wxArrayString(fields.begin() + 3, fields.end());
+        }
+    }
+
+    for ( const auto& device : GetLinuxDirEntries(blockDir, "") )
+    {
+        const wxString queueDir = blockDir + device + "/queue/";
+        wxULongLong_t sectorCount = 0;
+        wxString value;
+
+        // skip devices without media, such as unused loop devices
+        if ( !ReadLinuxFileLine(blockDir + device + "/size").ToULongLong(&sectorCount) || sectorCount == 0 )
+            continue;
+
+        // the size is always in 512-byte sectors
+        value.Printf(_("%s; scheduler %s, rotational %s, read-ahead %s kB, requests %s"),
+                     BytesToString(sectorCount * 512),
+                     GetLinuxSelectedOption(ReadLinuxFileLine(queueDir + "scheduler")),
+                     ReadLinuxFileLine(queueDir + "rotational") == "1" ? _("Yes") : _("No"),
+                     ReadLinuxFileLine(queueDir + "read_ahead_kb"),
+                     ReadLinuxFileLine(queueDir + "nr_requests"));
+
+        const auto it = diskStats.find(device);
+
+        if ( it != diskStats.end() )
+        {
+            const wxArrayString& stats = it->second;
+            wxULongLong_t readCount = 0, readSectors = 0, writeCount = 0, writeSectors = 0, IOTime = 0;
+
+            stats[0].ToULongLong(&readCount);
+            stats[2].ToULongLong(&readSectors);
+            stats[4].ToULongLong(&writeCount);
+            stats[6].ToULongLong(&writeSectors);
+            stats[9].ToULongLong(&IOTime);
+
+            value += wxString::Format(_("; read %s in %llu requests, written %s in %llu requests, in flight %s, IO time %.1f s"),
+                                      BytesToString(readSectors * 512), readCount,
+                                      BytesToString(writeSectors * 512), writeCount,
+                                      stats[8], IOTime / 1000.0);
+        }
+
+        items.emplace_back(wxString::Format(_("Block Device %s"), device), value);
+    }
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    NetworkView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class NetworkView : public SampledSysInfoListView
+{
+public:
+    NetworkView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    // the order of the counters in /proc/net/dev
+    enum
+    {
+        Counter_RXBytes = 0,
+        Counter_RXPackets,
+        Counter_RXErrors,
+        Counter_RXDrops,
+        Counter_TXBytes = 8,
+        Counter_TXPackets,
+        Counter_TXErrors,
+        Counter_TXDrops,
+        Counter_Count = 16,
+    };
+
+    std::map<wxString, std::vector<wxULongLong_t>> m_previousCounters; // interface, counters
+    long m_previousSampleTime{-1};
+
+    static std::map<wxString, std::vector<wxULongLong_t>> ReadCounters();
+};
+
+NetworkView::NetworkView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    UpdateValues();
+}
+
+void NetworkView::DoUpdateValues()
+{
+    static const wxString netDir("/sys/class/net/");
+    static const char* sysctlNames[] =
+    {
+        "core/rmem_default",
+        "core/rmem_max",
+        "core/wmem_default",
+        "core/wmem_max",
+        "core/netdev_max_backlog",
+        "core/somaxconn",
+        "core/busy_poll",
+        "core/busy_read",
+        "ipv4/tcp_rmem",
+        "ipv4/tcp_wmem",
+        "ipv4/tcp_congestion_control",
+        "ipv4/tcp_fastopen",
+    };
+
+    const long sampleTime = GetSampleTime();
+    const double elapsedSeconds = m_previousSampleTime >= 0 ? (sampleTime - m_previousSampleTime) / 1000.0 : 0;
+    const auto counters = ReadCounters();
+    std::vector<std::pair<wxString, wxString>> items;
+
+    for ( const auto& interfaceAndCounters : counters )
+    {
+        const wxString& interfaceName = interfaceAndCounters.first;
+        const std::vector<wxULongLong_t>& current = interfaceAndCounters.second;
+        const wxString interfaceDir = netDir + interfaceName + "/";
+        const auto previousIt = m_previousCounters.find(interfaceName);
+        long speed = -1;
+        wxString value;
+
+        // reading the speed fails for virtual interfaces and for those without a link
+        value.Printf(_("%s, MTU %s, speed %s, %zu RX queue(s), %zu TX queue(s), address %s"),
+                     ReadLinuxFileLine(interfaceDir + "operstate"),
+                     ReadLinuxFileLine(interfaceDir + "mtu"),
+                     ReadLinuxFileLine(interfaceDir + "speed").ToLong(&speed) && speed > 0
+                        ? wxString::Format(_("%ld Mb/s"), speed) : wxString(_("N/A")),
+                     GetLinuxDirEntries(interfaceDir + "queues", "rx-").size(),
+                     GetLinuxDirEntries(interfaceDir + "queues", "tx-").size(),
+                     ReadLinuxFileLine(interfaceDir + "address"));
+        items.emplace_back(wxString::Format(_("Interface %s"), interfaceName), value);
+
+        auto rate = [&](size_t counter) -> wxString
+        {
+            if ( previousIt == m_previousCounters.end() || elapsedSeconds <= 0
+                 || current[counter] < previousIt->second[counter] )
+                return wxEmptyString;
+
+            return wxString::Format(_(" (%.0f/s)"), (current[counter] - previousIt->second[counter]) / elapsedSeconds);
+        };
+
+        auto byteRate = [&](size_t counter) -> wxString
+        {
+            if ( previousIt == m_previousCounters.end() || elapsedSeconds <= 0
+                 || current[counter] < previousIt->second[counter] )
+                return wxEmptyString;
+
+            return wxString::Format(_(" (%s/s)"),
+                BytesToString(static_cast<wxULongLong_t>((current[counter] - previousIt->second[counter]) / elapsedSeconds)));
+        };
+
+        items.emplace_back(wxString::Format(_("Interface %s RX"), interfaceName),
+            wxString::Format(_("%s%s, %llu packets%s, %llu errors, %llu drops"),
+                BytesToString(current[Counter_RXBytes]), byteRate(Counter_RXBytes),
+                current[Counter_RXPackets], rate(Counter_RXPackets),
+                current[Counter_RXErrors], current[Counter_RXDrops]));
+        items.emplace_back(wxString::Format(_("Interface %s TX"), interfaceName),
+            wxString::Format(_("%s%s, %llu packets%s, %llu errors, %llu drops"),
+                BytesToString(current[Counter_TXBytes]), byteRate(Counter_TXBytes),
+                current[Counter_TXPackets], rate(Counter_TXPackets),
+                current[Counter_TXErrors], current[Counter_TXDrops]));
+    }
+
+    for ( const auto& sysctlName : sysctlNames )
+    {
+        wxString value;
+        wxString name = wxString("net.") + sysctlName;
+
+        if ( !ReadLinuxFile(wxString("/proc/sys/net/") + sysctlName, value) )
+            continue;
+
+        name.Replace("/", ".");
+        value = value.BeforeFirst('\n').Trim();
+        value.Replace("\t", " ");
+        items.emplace_back(name, value);
+    }
+
+    SetItemsWithValues(items);
+
+    m_previousCounters = counters;
+    m_previousSampleTime = sampleTime;
+}
+
+// e.g. "    lo: 1234 12 0 0 0 0 0 0 1234 12 0 0 0 0 0 0" after two header lines
+std::map<wxString, std::vector<wxULongLong_t>> NetworkView::ReadCounters()
+{
+    std::map<wxString, std::vector<wxULongLong_t>> counters;
+    wxString contents;
+
+    if ( !ReadLinuxFile("/proc/net/dev", contents) )
+    {
+        wxLogError(_("Could not read \"%s\"."), "/proc/net/dev");
+        return counters;
+    }
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        wxString fields;
+        wxString interfaceName = line.BeforeFirst(':', &fields);
+        std::vector<wxULongLong_t> values;
+
+        interfaceName.Trim(false).Trim();
+        if ( interfaceName.empty() || fields.empty() )
+            continue;
+
+        for ( const auto& field : wxSplit(fields, ' ', '\0') )
+        {
+            wxULongLong_t value = 0;
+
+            if ( !field.empty() && field.ToULongLong(&value) )
+                values.push_back(value);
+        }
+
+        if ( values.size() >= Counter_Count )
+            counters[interfaceName] = values;
+    }
+
+    return counters;
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    FileDescriptorsView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class FileDescriptorsView : public SampledSysInfoListView
+{
+public:
+    FileDescriptorsView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Descriptor = 0,
+        Column_Type,
+        Column_Target,
+        Column_Flags,
+        Column_Position,
+        Column_Count
+    };
+
+    struct DescriptorInfo
+    {
+        bool     isFile{false}; // a regular file
+        wxString target;
+        wxString type;
+        wxString flags;
+        wxString position;
+    };
+
+    // descriptor number, information from the previous update
+    std::map<long, DescriptorInfo> m_descriptors;
+
+    static wxString GetType(const wxString& target, const std::map<wxString, wxString>& socketProtocols);
+    static std::map<wxString, wxString> GetSocketProtocols();
+    static wxString FlagsToString(long flags);
+};
+
+FileDescriptorsView::FileDescriptorsView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 2000)
+{
+    InsertColumn(Column_Descriptor, _("Descriptor"));
+    InsertColumn(Column_Type, _("Type"));
+    InsertColumn(Column_Target, _("Target"));
+    InsertColumn(Column_Flags, _("Flags"));
+    InsertColumn(Column_Position, _("Position"));
+
+    UpdateValues();
+}
+
+// To keep the refresh cheap, only the link targets are read for all descriptors,
+// fdinfo is read only for new descriptors, those whose target changed, and regular
+// files whose position may have changed. The list items are also updated only
+// when their values changed.
+void FileDescriptorsView::DoUpdateValues()
+{
+    std::map<long, DescriptorInfo> descriptors;
+    std::map<wxString, wxString> socketProtocols;
+    bool socketProtocolsRead = false;
+
+    for ( const auto descriptor : GetLinuxNumberedEntries("/proc/self/fd", "") )
+    {
+        const wxString fdName = wxString::Format("/proc/self/fd/%ld", descriptor);
+        char target[PATH_MAX + 1];
+        const ssize_t targetLength = readlink(fdName.fn_str(), target, PATH_MAX);
+        DescriptorInfo info;
+
+        // the descriptor used for reading the directory is already closed
+        if ( targetLength < 0 )
+            continue;
+
+        target[targetLength] = '\0';
+        info.target = wxString(target);
+
+        const auto previousIt = m_descriptors.find(descriptor);
+
+        if ( previousIt != m_descriptors.end() && previousIt->second.target == info.target
+             && !previousIt->second.isFile )
+        {
+            descriptors[descriptor] = previousIt->second;
+            continue;
+        }
+
+        if ( info.target.StartsWith("socket:") && !socketProtocolsRead )
+        {
+            socketProtocols = GetSocketProtocols();
+            socketProtocolsRead = true;
+        }
+
+        // e.g. "pos:\t0\nflags:\t02100002\nmnt_id:\t15"
+        const auto fdInfo = ParseLinuxNameValueFile(wxString::Format("/proc/self/fdinfo/%ld", descriptor), ':');
+        const auto flagsIt = fdInfo.find("flags");
+        long flags = 0;
+
+        info.type = GetType(info.target, socketProtocols);
+        info.isFile = info.target.StartsWith("/") && !info.target.StartsWith("/dev/") && !info.target.StartsWith("/memfd:");
+        if ( flagsIt != fdInfo.end() && flagsIt->second.ToLong(&flags, 8) )
+            info.flags = FlagsToString(flags);
+        if ( fdInfo.count("pos") )
+            info.position = fdInfo.at("pos");
+
+        descriptors[descriptor] = info;
+    }
+
+    m_descriptors = descriptors;
+
+    std::vector<std::pair<long, wxArrayString>> items;
+    std::map<wxString, size_t> typeCounts;
+
+    for ( const auto& descriptorAndInfo : m_descriptors )
+    {
+        const DescriptorInfo& info = descriptorAndInfo.second;
+        wxArrayString columns;
+
+        columns.push_back(wxString::Format("%ld", descriptorAndInfo.first));
+        columns.push_back(info.type);
+        columns.push_back(info.target);
+        columns.push_back(info.flags);
+        columns.push_back(info.position);
+        items.emplace_back(descriptorAndInfo.first, columns);
+
+        typeCounts[info.type]++;
+    }
+
+    for ( const auto& typeAndCount : typeCounts )
+    {
+        wxArrayString columns;
+
+        columns.push_back(_("Summary"));
+        columns.push_back(typeAndCount.first);
+        columns.push_back(wxString::Format(_("%zu descriptor(s)"), typeAndCount.second));
+        columns.push_back(wxEmptyString);
+        columns.push_back(wxEmptyString);
+        items.emplace_back(-1, columns);
+    }
+
+    // the item data is the descriptor number or -1 for the summary
+    SetStoredItems(items);
+}
+
+// e.g. "/home/user/file", "socket:[12345]", "pipe:[12345]", "anon_inode:[eventfd]"
+wxString FileDescriptorsView::GetType(const wxString& target, const std::map<wxString, wxString>& socketProtocols)
+{
+    wxString inode;
+
+    if ( target.StartsWith("socket:", &inode) )
+    {
+        const auto it = socketProtocols.find(inode.AfterFirst('[').BeforeFirst(']'));
+
+        return it != socketProtocols.end() ? wxString::Format(_("Socket (%s)"), it->second) : wxString(_("Socket"));
+    }
+
+    if ( target.StartsWith("pipe:") )
+        return _("Pipe");
+
+    if ( target.StartsWith("anon_inode:", &inode) )
+    {
+        inode.Replace("[", "");
+        inode.Replace("]", "");
+
+        if ( inode == "eventpoll" )
+            return "epoll";
+
+        return inode;
+    }
+
+    if ( target.StartsWith("/memfd:") )
+        return "memfd";
+
+    if ( target.StartsWith("/dev/") )
+        return _("Device");
+
+    if ( target.StartsWith("/") )
+        return _("File");
+
+    return _("Other");
+}
+
+// maps socket inodes to their protocols, using the tables in /proc/self/net
+std::map<wxString, wxString> FileDescriptorsView::GetSocketProtocols()
+{
+    // file name, protocol name, index of the inode column
+    static const std::tuple<const char*, const char*, size_t> tables[] =
+    {
+        std::make_tuple("tcp",     "TCP",     9),
+        std::make_tuple("tcp6",    "TCPv6",   9),
+        std::make_tuple("udp",     "UDP",     9),
+        std::make_tuple("udp6",    "UDPv6",   9),
+        std::make_tuple("unix",    "Unix",    6),
+        std::make_tuple("netlink", "Netlink", 9),
+    };
+
+    std::map<wxString, wxString> protocols;
+
+    for ( const auto& table : tables )
+    {
+        wxString contents;
+
+        if ( !ReadLinuxFile(wxString("/proc/self/net/") + std::get<0>(table), contents) )
+            continue;
+
+        const wxArrayString lines = wxSplit(contents, '\n', '\0');
+
+        // the first line is the header
+        for ( size_t i = 1; i < lines.size(); ++i )
+        {
+            wxArrayString fields;
+
+            for ( const auto& field : wxSplit(lines[i], ' ', '\0') )
+            {
+                if ( !field.empty() )
+                    fields.push_back(field);
+            }
+
+            if ( fields.size() > std::get<2>(table) )
+                protocols[fields[std::get<2>(table)]] = std::get<1>(table);
+        }
+    }
+
+    return protocols;
+}
+
+wxString FileDescriptorsView::FlagsToString(long flags)
+{
+    wxString result;
+
+    switch ( flags & O_ACCMODE )
+    {
+        case O_RDONLY: result = "O_RDONLY"; break;
+        case O_WRONLY: result = "O_WRONLY"; break;
+        case O_RDWR:   result = "O_RDWR"; break;
+    }
+
+    if ( flags & O_APPEND )
+        result += "|O_APPEND";
+    if ( flags & O_NONBLOCK )
+        result += "|O_NONBLOCK";
+    if ( flags & O_CLOEXEC )
+        result += "|O_CLOEXEC";
+    if ( flags & O_SYNC )
+        result += "|O_SYNC";
+#ifdef O_DIRECT
+    if ( flags & O_DIRECT )
+        result += "|O_DIRECT";
+#endif
+#ifdef O_PATH
+    if ( flags & O_PATH )
+        result += "|O_PATH";
+#endif
+
+    return result;
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    ModulesView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+// The executable and the shared libraries loaded in the process.
+class ModulesView : public SysInfoListView
+{
+public:
+    ModulesView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Module = 0,
+        Column_LoadAddress,
+        Column_MappedSize,
+        Column_RSS,
+        Column_PSS,
+        Column_Relocated,
+    };
+
+    struct ModuleInfo
+    {
+        wxString      name;
+        wxUIntPtr     loadAddress{0};
+        wxULongLong_t mappedSize{0};
+    };
+
+    // in bytes
+    struct MemoryUsage
+    {
+        wxULongLong_t RSS{0};
+        wxULongLong_t PSS{0};
+    };
+
+    static int OnIteratePhdr(dl_phdr_info* info, size_t size, void* data);
+
+    // returns the memory usage of the mappings in /proc/self/smaps, by their path
+    static std::map<wxString, MemoryUsage> GetMappingsMemoryUsage();
+};
+
+ModulesView::ModulesView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Module, _("Module"));
+    InsertColumn(Column_LoadAddress, _("Load Address"));
+    InsertColumn(Column_MappedSize, _("Mapped Size"));
+    InsertColumn(Column_RSS, _("RSS"));
+    InsertColumn(Column_PSS, _("PSS"));
+    InsertColumn(Column_Relocated, _("Relocated"));
+
+    UpdateValues();
+}
+
+int ModulesView::OnIteratePhdr(dl_phdr_info* info, size_t WXUNUSED(size), void* data)
+{
+    std::vector<ModuleInfo>* modules = static_cast<std::vector<ModuleInfo>*>(data);
+    ModuleInfo module;
+
+    module.name = wxString(info->dlpi_name);
+    module.loadAddress = static_cast<wxUIntPtr>(info->dlpi_addr);
+
+    for ( ElfW(Half) i = 0; i < info->dlpi_phnum; ++i )
+    {
+        if ( info->dlpi_phdr[i].p_type == PT_LOAD )
+            module.mappedSize += info->dlpi_phdr[i].p_memsz;
+    }
+
+    modules->push_back(module);
+    return 0;
+}
+
+void ModulesView::DoUpdateValues()
+{
+    std::vector<ModuleInfo> modules;
+    const auto usages = GetMappingsMemoryUsage();
+
+    dl_iterate_phdr(&ModulesView::OnIteratePhdr, &modules);
 
-#ifdef __WXGTK__
-    APPEND_DEFINE_ITEM(wxUSE_DETECT_SM)
-    APPEND_DEFINE_ITEM(wxUSE_GTKPRINT)
-#endif // #ifdef __WXGTK__
+    std::vector<std::pair<long, wxArrayString>> items;
 
-#ifdef __UNIX__
-    APPEND_DEFINE_ITEM(wxUSE_EPOLL_DISPATCHER)
-    APPEND_DEFINE_ITEM(wxUSE_SELECT_DISPATCHER)
-    APPEND_DEFINE_ITEM(wxUSE_GSTREAMER)
-    APPEND_DEFINE_ITEM(wxUSE_LIBMSPACK)
-    APPEND_DEFINE_ITEM(wxUSE_LIBSDL)
-    APPEND_DEFINE_ITEM(wxUSE_PLUGINS)
-    APPEND_DEFINE_ITEM(wxUSE_XTEST)
-#endif // #ifdef __UNIX__
+    for ( const auto& module : modules )
+    {
+        wxString name = module.name;
+        wxString path;
 
-#ifdef __WXMAC__
-    APPEND_DEFINE_ITEM(wxUSE_WEBKIT)
-#endif// #ifdef __WXMAC__
+        // the name of the executable is empty
+        if ( name.empty() )
+        {
+            char exePath[PATH_MAX + 1];
+            const ssize_t exePathLength = readlink("/proc/self/exe", exePath, PATH_MAX);
 
-#ifdef __WXUNIVERSAL__
-    APPEND_DEFINE_ITEM(wxUSE_ALL_THEMES)
-    APPEND_DEFINE_ITEM(wxUSE_THEME_GTK)
-    APPEND_DEFINE_ITEM(wxUSE_THEME_METAL)
-    APPEND_DEFINE_ITEM(wxUSE_THEME_MONO)
-    APPEND_DEFINE_ITEM(wxUSE_THEME_WIN32)
-#endif // #ifdef __WXUNIVERSAL__
+            if ( exePathLength > 0 )
+            {
+                exePath[exePathLength] = '\0';
+                name = path = wxString(exePath);
+            }
+        }
+        else if ( char* realPath = realpath(name.fn_str(), nullptr) )
+        {
+            // the mappings in smaps have symbolic links resolved
+            path = wxString(realPath);
+            free(realPath);
+        }
+        else if ( name.StartsWith("linux-vdso") || name.StartsWith("linux-gate") )
+        {
+            path = "[vdso]";
+        }
 
+        wxArrayString columns;
 
-    bool hasDefine;
+        columns.push_back(name);
+        columns.push_back(wxString::Format("%#llx", static_cast<wxULongLong_t>(module.loadAddress)));
+        columns.push_back(BytesToString(module.mappedSize));
 
-#ifdef wxHAS_3STATE_CHECKBOX
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_3STATE_CHECKBOX", hasDefine)
+        const auto usageIt = usages.find(path);
 
-#ifdef wxHAS_ATOMIC_OPS
-    hasDefine = true;
+        if ( usageIt != usages.end() )
+        {
+            columns.push_back(BytesToString(usageIt->second.RSS));
+            columns.push_back(BytesToString(usageIt->second.PSS));
+        }
+        else
+        {
+            columns.push_back(wxEmptyString);
+            columns.push_back(wxEmptyString);
+        }
+
+        // the load address is 0 for non-PIE executables and prelinked libraries
+        // loaded at their preferred address
+        columns.push_back(module.loadAddress != 0 ? _("Yes") : _("No"));
+
+        items.emplace_back(static_cast<long>(items.size()), columns);
+    }
+
+    // the totals for the whole process, including anonymous memory
+    const auto rollup = ParseLinuxMemInfo("/proc/self/smaps_rollup");
+
+    if ( rollup.count("Rss") )
+    {
+        wxArrayString columns;
+
+        columns.push_back(_("<All Mappings>"));
+        columns.push_back(wxEmptyString);
+        columns.push_back(wxEmptyString);
+        columns.push_back(BytesToString(rollup.at("Rss") * 1024));
+        columns.push_back(rollup.count("Pss") ? BytesToString(rollup.at("Pss") * 1024) : wxString());
+
+        items.emplace_back(static_cast<long>(items.size()), columns);
+    }
+
+    SetStoredItems(items);
+}
+
+// smaps consists of a header line for each mapping, e.g.
+// "7f2c1a1e5000-7f2c1a20b000 r--p 00000000 08:01 1234  /usr/lib/x86_64-linux-gnu/libc.so.6",
+// followed by lines with its values, e.g. "Rss:  140 kB"
+std::map<wxString, ModulesView::MemoryUsage> ModulesView::GetMappingsMemoryUsage()
+{
+    std::map<wxString, MemoryUsage> usages;
+    wxString contents;
+    MemoryUsage* usage = nullptr;
+
+    if ( !ReadLinuxFile("/proc/self/smaps", contents) )
+        return usages;
+
+    for ( const auto& line : wxSplit(contents, '\n', '\0') )
+    {
+        wxString value;
+        const wxString name = line.BeforeFirst(':', &value);
+        wxULongLong_t kiB = 0;
+
+        // the names of the values are single words followed by a colon,
+        // the header lines start with the address range followed by a space
+        if ( name.find(' ') == wxString::npos )
+        {
+            if ( usage && value.Trim(false).BeforeFirst(' ').ToULongLong(&kiB) )
+            {
+                if ( name == "Rss" )
+                    usage->RSS += kiB * 1024;
+                else if ( name == "Pss" )
+                    usage->PSS += kiB * 1024;
+            }
+            continue;
+        }
+
+        // the path is the sixth field, it can contain spaces
+        const wxArrayString fields = wxSplit(line, ' ', '\0');
+        size_t fieldIndex = 0;
+        size_t pathStart = wxString::npos;
+
+        for ( size_t i = 0, pos = 0; i < fields.size(); pos += fields[i].length() + 1, ++i )
+        {
+            if ( fields[i].empty() )
+                continue;
+
+            if ( fieldIndex++ == 5 )
+            {
+                pathStart = pos;
+                break;
+            }
+        }
+
+        usage = pathStart != wxString::npos ? &usages[line.Mid(pathStart)] : nullptr;
+    }
+
+    return usages;
+}
+
+#endif // #ifdef __LINUX__
+
+/*************************************************
+
+    HeapView
+
+*************************************************/
+
+#if defined(__LINUX__) && defined(__GLIBC__)
+
+// The statistics of the heap allocator. Besides glibc malloc, the statistics of
+// jemalloc and tcmalloc are shown when the application is linked with them
+// (or they are preloaded); their functions are declared weak, so they are null otherwise.
+extern "C"
+{
+    int mallctl(const char* name, void* oldp, size_t* oldlenp, void* newp, size_t newlen) __attribute__((weak));
+    int MallocExtension_GetNumericProperty(const char* property, size_t* value) __attribute__((weak));
+}
+
+class HeapView : public SysInfoListView
+{
+public:
+    HeapView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetNameAndValueValues(Column_Name, Column_Value, separator);
+    }
+
+    int GetVolatilities() const override { return Volatility_Live; }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Name = 0,
+        Column_Value,
+    };
+
+    wxString m_lastTrimResult;
+
+    void AppendGlibcValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendJemallocValues(std::vector<std::pair<wxString, wxString>>& items);
+    void AppendTcmallocValues(std::vector<std::pair<wxString, wxString>>& items);
+
+    // releases the free memory back to the system with malloc_trim()
+    void TrimHeap();
+
+    void OnContextMenu(wxContextMenuEvent& event);
+
+    // in bytes
+    static wxULongLong_t GetResidentSetSize();
+    // returns the number of arenas, parsed from the output of malloc_info()
+    static size_t GetGlibcArenaCount();
+};
+
+HeapView::HeapView(wxWindow* parent)
+    : SysInfoListView(parent)
+{
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_Value, _("Value"));
+
+    Bind(wxEVT_CONTEXT_MENU, &HeapView::OnContextMenu, this);
+
+    UpdateValues();
+}
+
+void HeapView::DoUpdateValues()
+{
+    std::vector<std::pair<wxString, wxString>> items;
+
+    AppendGlibcValues(items);
+    AppendJemallocValues(items);
+    AppendTcmallocValues(items);
+
+    if ( !m_lastTrimResult.empty() )
+        items.emplace_back(_("Last Trim"), m_lastTrimResult);
+
+    SetItemsWithValues(items);
+}
+
+void HeapView::AppendGlibcValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+#if __GLIBC_PREREQ(2, 33)
+    const struct mallinfo2 info = mallinfo2();
+#else
+    // the values are int and wrap around with more than 2 GiB allocated
+    const struct mallinfo info = mallinfo();
 #endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_ATOMIC_OPS", hasDefine)
+    const wxULongLong_t inUseBytes = info.uordblks;
+    const wxULongLong_t freeBytes = info.fordblks;
+    const size_t arenaCount = GetGlibcArenaCount();
+
+    if ( arenaCount > 0 )
+        items.emplace_back(_("glibc Arenas"), wxString::Format("%zu", arenaCount));
+
+    items.emplace_back(_("glibc Main Arena Size (arena)"), BytesToString(info.arena));
+    items.emplace_back(_("glibc In Use (uordblks)"), BytesToString(inUseBytes));
+    items.emplace_back(_("glibc Free (fordblks)"), BytesToString(freeBytes));
+
+    // the share of the heap that is free, a rough measure of its fragmentation
+    if ( inUseBytes + freeBytes > 0 )
+    {
+        items.emplace_back(_("glibc Free / (In Use + Free)"),
+            wxString::Format("%.1f %%", 100.0 * freeBytes / (inUseBytes + freeBytes)));
+    }
+
+    items.emplace_back(_("glibc Free Chunks (ordblks)"), wxString::Format("%llu", static_cast<wxULongLong_t>(info.ordblks)));
+    items.emplace_back(_("glibc Fastbin Free Chunks (smblks)"), wxString::Format("%llu", static_cast<wxULongLong_t>(info.smblks)));
+    items.emplace_back(_("glibc Fastbin Free (fsmblks)"), BytesToString(info.fsmblks));
+    items.emplace_back(_("glibc Mmapped Regions (hblks)"), wxString::Format("%llu", static_cast<wxULongLong_t>(info.hblks)));
+    items.emplace_back(_("glibc Mmapped (hblkhd)"), BytesToString(info.hblkhd));
+    items.emplace_back(_("glibc Releasable Top (keepcost)"), BytesToString(info.keepcost));
+}
+
+void HeapView::AppendJemallocValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    if ( !mallctl )
+        return;
+
+    // the statistics are cached by jemalloc, refreshing the epoch updates them
+    wxUint64 epoch = 1;
+    size_t epochSize = sizeof(epoch);
+
+    mallctl("epoch", &epoch, &epochSize, &epoch, epochSize);
+
+    unsigned arenaCount = 0;
+    size_t arenaCountSize = sizeof(arenaCount);
+
+    if ( mallctl("arenas.narenas", &arenaCount, &arenaCountSize, nullptr, 0) == 0 )
+        items.emplace_back(_("jemalloc Arenas"), wxString::Format("%u", arenaCount));
+
+    static const char* const statistics[] =
+    {
+        "stats.allocated", "stats.active", "stats.metadata",
+        "stats.resident", "stats.mapped", "stats.retained"
+    };
+
+    for ( const auto& statistic : statistics )
+    {
+        size_t value = 0;
+        size_t valueSize = sizeof(value);
+
+        if ( mallctl(statistic, &value, &valueSize, nullptr, 0) == 0 )
+            items.emplace_back(wxString::Format(_("jemalloc %s"), statistic), BytesToString(value));
+    }
+}
+
+void HeapView::AppendTcmallocValues(std::vector<std::pair<wxString, wxString>>& items)
+{
+    if ( !MallocExtension_GetNumericProperty )
+        return;
+
+    static const char* const properties[] =
+    {
+        "generic.current_allocated_bytes", "generic.heap_size",
+        "tcmalloc.pageheap_free_bytes", "tcmalloc.pageheap_unmapped_bytes",
+        "tcmalloc.central_cache_free_bytes", "tcmalloc.thread_cache_free_bytes"
+    };
+
+    for ( const auto& property : properties )
+    {
+        size_t value = 0;
+
+        if ( MallocExtension_GetNumericProperty(property, &value) )
+            items.emplace_back(wxString::Format(_("tcmalloc %s"), property), BytesToString(value));
+    }
+}
+
+void HeapView::TrimHeap()
+{
+    const wxULongLong_t RSSBefore = GetResidentSetSize();
+    const bool released = malloc_trim(0) != 0;
+    const wxULongLong_t RSSAfter = GetResidentSetSize();
+
+    if ( !released )
+        m_lastTrimResult = _("No memory released");
+    else if ( RSSBefore > RSSAfter )
+        m_lastTrimResult.Printf(_("Resident set size decreased by %s"), BytesToString(RSSBefore - RSSAfter));
+    else
+        m_lastTrimResult = _("Memory released, resident set size did not decrease");
+
+    m_lastTrimResult += wxString::Format(_(" (at %s)"), wxDateTime::Now().FormatISOTime());
+
+    UpdateValues();
+}
+
+// allows the user to trim the heap
+void HeapView::OnContextMenu(wxContextMenuEvent& event)
+{
+    wxMenu menu;
+    wxPoint position = event.GetPosition();
+
+    menu.Append(wxID_HIGHEST + 1, _("Trim Heap (malloc_trim)"));
+
+    // the position is wxDefaultPosition when the menu was invoked from the keyboard
+    if ( position != wxDefaultPosition )
+        position = ScreenToClient(position);
+
+    if ( GetPopupMenuSelectionFromUser(menu, position) == wxID_HIGHEST + 1 )
+        TrimHeap();
+}
+
+wxULongLong_t HeapView::GetResidentSetSize()
+{
+    // the value is in kB
+    const auto values = ParseLinuxMemInfo("/proc/self/status");
+    const auto it = values.find("VmRSS");
+
+    return it != values.end() ? it->second * 1024 : 0;
+}
+
+size_t HeapView::GetGlibcArenaCount()
+{
+    char* buffer = nullptr;
+    size_t bufferSize = 0;
+    FILE* stream = open_memstream(&buffer, &bufferSize);
+    size_t arenaCount = 0;
+
+    if ( !stream )
+        return 0;
+
+    // there is a <heap nr="N"> element for each arena
+    if ( malloc_info(0, stream) == 0 )
+    {
+        fflush(stream);
+        for ( const char* s = buffer; s && (s = strstr(s, "<heap nr=")) != nullptr; ++s )
+            ++arenaCount;
+    }
+
+    fclose(stream);
+    free(buffer);
+
+    return arenaCount;
+}
+
+#endif // #if defined(__LINUX__) && defined(__GLIBC__)
+
+/*************************************************
+
+    ThreadsView
+
+*************************************************/
+
+#ifdef __LINUX__
+
+class ThreadsView : public SampledSysInfoListView
+{
+public:
+    ThreadsView(wxWindow* parent);
+
+    wxArrayString GetValues(const wxString& separator) const override
+    {
+        return GetAllColumnsValues(separator);
+    }
+
+protected:
+    void DoUpdateValues() override;
+private:
+    enum
+    {
+        Column_Id = 0,
+        Column_Name,
+        Column_State,
+        Column_CPUUsage,
+        Column_CPUTime,
+        Column_LastCPU,
+        Column_Nice,
+        Column_Policy,
+    };
+
+    struct ThreadInfo
+    {
+        long          id{0};
+        wxString      name;
+        wxString      state;
+        wxULongLong_t CPUTicks{0}; // user + system
+        double        CPUUsage{-1}; // percent of a CPU since the last sample, -1 if not known
+        wxString      lastCPU;
+        wxString      nice;
+        wxString      policy;
+    };
+
+    std::map<long, wxULongLong_t> m_previousCPUTicks; // thread id, ticks
+    long m_previousSampleTime{-1};
+
+    static bool ReadThreadInfo(long threadId, ThreadInfo& info);
+    static wxString StateToString(const wxString& state);
+    static wxString PolicyToString(const wxString& policy);
+};
+
+ThreadsView::ThreadsView(wxWindow* parent)
+    : SampledSysInfoListView(parent, 1000)
+{
+    InsertColumn(Column_Id, _("Id"));
+    InsertColumn(Column_Name, _("Name"));
+    InsertColumn(Column_State, _("State"));
+    InsertColumn(Column_CPUUsage, _("CPU Usage"));
+    InsertColumn(Column_CPUTime, _("CPU Time"));
+    InsertColumn(Column_LastCPU, _("Last CPU"));
+    InsertColumn(Column_Nice, _("Nice"));
+    InsertColumn(Column_Policy, _("Scheduling Policy"));
+
+    UpdateValues();
+}
+
+// Reads /proc/self/task/<id>/stat, see proc(5) for the description of the fields.
+bool ThreadsView::ReadThreadInfo(long threadId, ThreadInfo& info)
+{
+    const wxString taskDir = wxString::Format("/proc/self/task/%ld/", threadId);
+    const wxString stat = ReadLinuxFileLine(taskDir + "stat");
+
+    // the thread name in parentheses can contain spaces and parentheses,
+    // so the fields are split only after the last closing parenthesis;
+    // fields[0] is then the third field (state)
+    const wxArrayString fields = wxSplit(stat.AfterLast(')').Trim(false), ' ', '\0');
+    wxULongLong_t userTicks = 0, systemTicks = 0;
+
+    if ( fields.size() < 39 || !fields[11].ToULongLong(&userTicks) || !fields[12].ToULongLong(&systemTicks) )
+        return false;
+
+    info.id       = threadId;
+    info.name     = ReadLinuxFileLine(taskDir + "comm");
+    info.state    = StateToString(fields[0]);
+    info.CPUTicks = userTicks + systemTicks;
+    info.nice     = fields[16];
+    info.lastCPU  = fields[36];
+    info.policy   = PolicyToString(fields[38]);
+
+    return true;
+}
+
+wxString ThreadsView::StateToString(const wxString& state)
+{
+    if ( state == "R" ) return _("Running");
+    if ( state == "S" ) return _("Sleeping");
+    if ( state == "D" ) return _("Disk Sleep");
+    if ( state == "Z" ) return _("Zombie");
+    if ( state == "T" ) return _("Stopped");
+    if ( state == "t" ) return _("Tracing Stop");
+    if ( state == "X" ) return _("Dead");
+    if ( state == "I" ) return _("Idle");
+
+    return state;
+}
+
+wxString ThreadsView::PolicyToString(const wxString& policy)
+{
+    long value = -1;
+
+    if ( !policy.ToLong(&value) )
+        return policy;
+
+    switch ( value )
+    {
+        case 0: return "SCHED_OTHER";
+        case 1: return "SCHED_FIFO";
+        case 2: return "SCHED_RR";
+        case 3: return "SCHED_BATCH";
+        case 5: return "SCHED_IDLE";
+        case 6: return "SCHED_DEADLINE";
+    }
+
+    return policy;
+}
 
-#ifdef wxHAS_BITMAPTOGGLEBUTTON
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_BITMAPTOGGLEBUTTON", hasDefine)
+void ThreadsView::DoUpdateValues()
+{
+    static const long ticksPerSecond = sysconf(_SC_CLK_TCK);
 
-#ifdef wxHAS_MEMBER_DEFAULT
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_MEMBER_DEFAULT", hasDefine)
+    const long sampleTime = GetSampleTime();
+    const double elapsedSeconds = m_previousSampleTime >= 0 ? (sampleTime - m_previousSampleTime) / 1000.0 : 0;
+    std::vector<ThreadInfo> threads;
+    std::map<long, wxULongLong_t> CPUTicks;
 
-#ifdef wxHAS_LARGE_FILES
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_LARGE_FILES", hasDefine)
+    for ( const auto threadId : GetLinuxNumberedEntries("/proc/self/task", "") )
+    {
+        ThreadInfo info;
 
-#ifdef wxHAS_LARGE_FFILES
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_LARGE_FFILES", hasDefine)
+        if ( !ReadThreadInfo(threadId, info) )
+            continue;
 
-#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG", hasDefine)
+        const auto it = m_previousCPUTicks.find(threadId);
 
-#ifdef wxHAS_MULTIPLE_FILEDLG_FILTERS
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_MULTIPLE_FILEDLG_FILTERS", hasDefine)
+        if ( it != m_previousCPUTicks.end() && elapsedSeconds > 0 && ticksPerSecond > 0 )
+            info.CPUUsage = 100.0 * (info.CPUTicks - it->second) / ticksPerSecond / elapsedSeconds;
 
-#ifdef wxHAS_NATIVE_ANIMATIONCTRL
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_ANIMATIONCTRL", hasDefine)
+        CPUTicks[threadId] = info.CPUTicks;
+        threads.push_back(info);
+    }
 
-#ifdef wxHAS_NATIVE_DATAVIEWCTRL
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_DATAVIEWCTRL", hasDefine)
+    m_previousCPUTicks = CPUTicks;
+    m_previousSampleTime = sampleTime;
 
-#ifdef wxHAS_NATIVE_WINDOW
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_NATIVE_WINDOW", hasDefine)
+    // the busiest threads first
+    std::sort(threads.begin(), threads.end(),
+        [](const ThreadInfo& a, const ThreadInfo& b)
+        {
+            if ( a.CPUUsage != b.CPUUsage )
+                return a.CPUUsage > b.CPUUsage;
+            return a.id < b.id;
+        });
 
-#ifdef wxHAS_NOEXCEPT
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_NOEXCEPT", hasDefine)
+    // keep the same thread selected, the items are rebuilt on each sample
+    const long selectedItemIndex = GetFirstSelectedStoredItem();
+    const long selectedThreadId = selectedItemIndex != -1 ? static_cast<long>(GetStoredItemData(selectedItemIndex)) : -1;
 
-#ifdef wxHAS_NULLPTR_T
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_NULLPTR_T", hasDefine)
+    DeleteAllStoredItems();
 
-#ifdef wxHAS_IMAGES_IN_RESOURCES
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_IMAGES_IN_RESOURCES", hasDefine)
+    for ( const auto& thread : threads )
+    {
+        const long itemIndex = AppendItemWithData(wxString::Format("%ld", thread.id), thread.id);
 
-#ifdef wxHAS_POWER_EVENTS
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_POWER_EVENTS", hasDefine)
+        if ( itemIndex == -1 )
+            continue;
 
-#ifdef wxHAS_RADIO_MENU_ITEMS
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_RADIO_MENU_ITEMS", hasDefine)
+        SetStoredItem(itemIndex, Column_Name, thread.name);
+        SetStoredItem(itemIndex, Column_State, thread.state);
+        SetStoredItem(itemIndex, Column_CPUUsage, thread.CPUUsage >= 0 ? wxString::Format(_("%.1f%%"), thread.CPUUsage) : _("<Evaluating...>"));
+        SetStoredItem(itemIndex, Column_CPUTime, ticksPerSecond > 0 ? wxString::Format(_("%.2f s"), static_cast<double>(thread.CPUTicks) / ticksPerSecond) : _("N/A"));
+        SetStoredItem(itemIndex, Column_LastCPU, thread.lastCPU);
+        SetStoredItem(itemIndex, Column_Nice, thread.nice);
+        SetStoredItem(itemIndex, Column_Policy, thread.policy);
 
-#ifdef wxHAS_RAW_BITMAP
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_RAW_BITMAP", hasDefine)
+        if ( thread.id == selectedThreadId )
+        {
+            SelectStoredItem(itemIndex);
+            FocusStoredItem(itemIndex);
+        }
+    }
+}
 
-#ifdef wxHAS_RAW_KEY_CODES
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_RAW_KEY_CODES", hasDefine)
+#endif // #ifdef __LINUX__
 
-#ifdef wxHAS_REGEX_ADVANCED
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_REGEX_ADVANCED", hasDefine)
+EventLoopView* FindEventLoopView(wxNotebook* pages)
+{
+    const size_t pageCount = pages->GetPageCount();
 
-#ifdef wxHAS_TASK_BAR_ICON
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_TASK_BAR_ICON", hasDefine)
+    for ( size_t i = 0; i < pageCount; ++i )
+    {
+        EventLoopView* view = dynamic_cast<EventLoopView*>(pages->GetPage(i));
 
-#ifdef wxHAS_WINDOW_LABEL_IN_STATIC_BOX
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_WINDOW_LABEL_IN_STATIC_BOX", hasDefine)
+        if ( view )
+            return view;
+    }
 
-#ifdef wxHAS_MODE_T
-    hasDefine = true;
-#endif
-    APPEND_HAS_FEATURE_ITEM("wxHAS_MODE_T", hasDefine)
+    return nullptr;
+}
+
+// viewFlag is the wxSystemInformationFrame::CreateFlags View* value of the view
+void AddView(wxNotebook* pages, SysInfoListView* view, long viewFlag, const wxString& title, bool select = false)
+{
+    view->SetViewFlag(viewFlag);
+    pages->AddPage(view, title, select);
 }
 
 } // anonymous namespace for helper classes
@@ -2634,6 +8034,14 @@ wxSystemInformationFrame::wxSystemInformationFrame(wxWindow* parent, const wxSiz
     Create(parent, wxID_ANY, "wxSystemInformationFrame", wxDefaultPosition, size, wxDEFAULT_FRAME_STYLE, createFlags);
 }
 
+wxSystemInformationFrame::~wxSystemInformationFrame()
+{
+    StopStallWatchdog();
+#ifdef __WXGTK__
+    DisconnectGTKSettingsNotifications();
+#endif // #ifdef __WXGTK__
+}
+
 
 bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxString &title,
                                       const wxPoint& pos, const wxSize& size,
@@ -2643,6 +8051,7 @@ bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxS
         return false;
 
     m_autoRefresh = createFlags & AutoRefresh;
+    m_liveRefresh = createFlags & LiveRefresh;
 
     wxPanel* mainPanel = new wxPanel(this);
     wxBoxSizer* mainPanelSizer = new wxBoxSizer(wxVERTICAL);
@@ -2671,6 +8080,21 @@ bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxS
     saveButton ->Bind(wxEVT_BUTTON, &wxSystemInformationFrame::OnSave, this);
     buttonSizer->Add(saveButton , wxSizerFlags().Border(wxRIGHT));
 
+    // finds the items on all the pages as the text is typed,
+    // the search button (or Enter) finds the next item
+    m_searchCtrl = new wxSearchCtrl(mainPanel, wxID_ANY);
+    m_searchCtrl->SetDescriptiveText(_("Find"));
+    m_searchCtrl->Bind(wxEVT_TEXT, &wxSystemInformationFrame::OnFindText, this);
+    m_searchCtrl->Bind(wxEVT_SEARCHCTRL_SEARCH_BTN, &wxSystemInformationFrame::OnFindNextText, this);
+    buttonSizer->Add(m_searchCtrl, wxSizerFlags().Border(wxRIGHT));
+
+    // shows only the items of the current page containing the text,
+    // each page keeps its own filter
+    m_filterCtrl = new wxSearchCtrl(mainPanel, wxID_ANY);
+    m_filterCtrl->SetDescriptiveText(_("Filter"));
+    m_filterCtrl->Bind(wxEVT_TEXT, &wxSystemInformationFrame::OnFilterText, this);
+    buttonSizer->Add(m_filterCtrl, wxSizerFlags().Border(wxRIGHT));
+
     // to move the button after it to the very right
     buttonSizer->AddStretchSpacer(1);
 
@@ -2685,34 +8109,88 @@ bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxS
     m_pages = new wxNotebook(mainPanel, wxID_ANY);
 
     if ( createFlags & ViewSystemColours )
-        m_pages->AddPage(new SystemColourView(m_pages), _("wxSYS Colours"), true);
+        AddView(m_pages, new SystemColourView(m_pages), ViewSystemColours, _("wxSYS Colours"), true);
 
     if ( createFlags & ViewSystemFonts )
-        m_pages->AddPage(new SystemFontView(m_pages), _("wxSYS Fonts"));
+        AddView(m_pages, new SystemFontView(m_pages), ViewSystemFonts, _("wxSYS Fonts"));
 
     if ( createFlags & ViewSystemMetrics )
-        m_pages->AddPage(new SystemMetricView(m_pages), _("wxSYS Metrics"));
+        AddView(m_pages, new SystemMetricView(m_pages), ViewSystemMetrics, _("wxSYS Metrics"));
 
     if ( createFlags & ViewDisplays )
-        m_pages->AddPage(new DisplaysView(m_pages), _("Displays"));
+        AddView(m_pages, new DisplaysView(m_pages), ViewDisplays, _("Displays"));
 
     if ( createFlags & ViewStandardPaths )
-        m_pages->AddPage(new StandardPathsView(m_pages), _("Standard Paths"));
+        AddView(m_pages, new StandardPathsView(m_pages), ViewStandardPaths, _("Standard Paths"));
 
     if ( createFlags & ViewSystemOptions )
-        m_pages->AddPage(new SystemOptionsView(m_pages), _("System Options"));
+        AddView(m_pages, new SystemOptionsView(m_pages), ViewSystemOptions, _("System Options"));
 
     if ( createFlags & ViewEnvironmentVariables )
-        m_pages->AddPage(new EnvironmentVariablesView(m_pages), _("Environment Variables"));
+        AddView(m_pages, new EnvironmentVariablesView(m_pages), ViewEnvironmentVariables, _("Environment Variables"));
 
     if ( createFlags & ViewMiscellaneous )
-        m_pages->AddPage(new MiscellaneousView(m_pages), _("Miscellaneous"));
+        AddView(m_pages, new MiscellaneousView(m_pages), ViewMiscellaneous, _("Miscellaneous"));
 
     if ( createFlags & ViewPreprocessorDefines )
-        m_pages->AddPage(new PreprocessorDefinesView(m_pages), _("Preprocessor Defines"));
+        AddView(m_pages, new PreprocessorDefinesView(m_pages), ViewPreprocessorDefines, _("Preprocessor Defines"));
+
+    if ( createFlags & ViewEventLoop )
+        AddView(m_pages, new EventLoopView(m_pages), ViewEventLoop, _("Event Loop"));
+
+#ifdef __LINUX__
+    if ( createFlags & ViewCPUTopology )
+        AddView(m_pages, new CPUTopologyView(m_pages), ViewCPUTopology, _("CPU Topology"));
+
+    if ( createFlags & ViewNUMA )
+        AddView(m_pages, new NUMAView(m_pages), ViewNUMA, _("NUMA"));
+
+    if ( createFlags & ViewCGroup )
+        AddView(m_pages, new CGroupView(m_pages), ViewCGroup, _("CGroup"));
+
+    if ( createFlags & ViewProcessResources )
+        AddView(m_pages, new ProcessResourcesView(m_pages), ViewProcessResources, _("Process Resources"));
+
+    if ( createFlags & ViewThreads )
+        AddView(m_pages, new ThreadsView(m_pages), ViewThreads, _("Threads"));
+
+    if ( createFlags & ViewMemory )
+        AddView(m_pages, new LinuxMemoryView(m_pages), ViewMemory, _("Memory"));
+
+    if ( createFlags & ViewPressure )
+        AddView(m_pages, new PressureView(m_pages), ViewPressure, _("Pressure"));
+
+    if ( createFlags & ViewCPUUsage )
+        AddView(m_pages, new CPUUsageView(m_pages), ViewCPUUsage, _("CPU Usage"));
+
+    if ( createFlags & ViewKernel )
+        AddView(m_pages, new KernelView(m_pages), ViewKernel, _("Kernel"));
+
+    if ( createFlags & ViewStorage )
+        AddView(m_pages, new StorageView(m_pages), ViewStorage, _("Storage"));
+
+    if ( createFlags & ViewNetwork )
+        AddView(m_pages, new NetworkView(m_pages), ViewNetwork, _("Network"));
+
+    if ( createFlags & ViewFileDescriptors )
+        AddView(m_pages, new FileDescriptorsView(m_pages), ViewFileDescriptors, _("File Descriptors"));
+
+    if ( createFlags & ViewModules )
+        AddView(m_pages, new ModulesView(m_pages), ViewModules, _("Modules"));
+#ifdef __GLIBC__
+    if ( createFlags & ViewHeap )
+        AddView(m_pages, new HeapView(m_pages), ViewHeap, _("Heap"));
+#endif // #ifdef __GLIBC__
+#endif // #ifdef __LINUX__
+
+#ifdef __UNIX__
+    if ( createFlags & ViewResourceLimits )
+        AddView(m_pages, new ResourceLimitsView(m_pages), ViewResourceLimits, _("Resource Limits"));
+#endif // #ifdef __UNIX__
 
     wxASSERT_MSG(m_pages->GetPageCount() > 0, "Invalid createFlags: no View value specified");
 
+    m_pages->Bind(wxEVT_NOTEBOOK_PAGE_CHANGED, &wxSystemInformationFrame::OnPageChanged, this);
     mainPanelSizer->Add(m_pages, wxSizerFlags().Proportion(5).Expand().Border());
 
     // Add a log control
@@ -2733,7 +8211,12 @@ bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxS
         detailsButton->Bind(wxEVT_UPDATE_UI, &wxSystemInformationFrame::OnUpdateUI, this);
 
     m_valuesUpdateTimer.SetOwner(this);
-    Bind(wxEVT_TIMER, &wxSystemInformationFrame::OnUpdateValuesTimer, this);
+    Bind(wxEVT_TIMER, &wxSystemInformationFrame::OnUpdateValuesTimer, this, m_valuesUpdateTimer.GetId());
+
+    // the single timer scheduling the samples of all the pages
+    m_sampleTimer.SetOwner(this);
+    Bind(wxEVT_TIMER, &wxSystemInformationFrame::OnSampleTimer, this, m_sampleTimer.GetId());
+    m_sampleTimer.Start(SampleTimerInterval);
 
     Bind(wxEVT_SYS_COLOUR_CHANGED, &wxSystemInformationFrame::OnSysColourChanged, this);
     Bind(wxEVT_DISPLAY_CHANGED, &wxSystemInformationFrame::OnDisplayChanged, this);
@@ -2742,11 +8225,34 @@ bool wxSystemInformationFrame::Create(wxWindow *parent, wxWindowID id, const wxS
     Bind(wxEVT_DPI_CHANGED, &wxSystemInformationFrame::OnDPIChanged, this);
 #endif
 
+    Bind(wxEVT_THREAD, &wxSystemInformationFrame::OnStallWatchdogPing, this, StallWatchdogEvent_Ping);
+    Bind(wxEVT_THREAD, &wxSystemInformationFrame::OnStallWatchdogStall, this, StallWatchdogEvent_Stall);
+
+#ifdef __WXGTK__
+    ConnectGTKSettingsNotifications();
+#endif // #ifdef __WXGTK__
+
     return true;
 }
 
+void wxSystemInformationFrame::SetStallWatchdogDeadline(int deadline)
+{
+    wxCHECK_RET(deadline >= 0, "invalid stall watchdog deadline");
+
+    StopStallWatchdog();
+
+    m_stallWatchdogDeadline = deadline;
+
+    if ( m_stallWatchdogDeadline > 0 )
+        StartStallWatchdog();
+}
+
 wxArrayString wxSystemInformationFrame::GetValues(const wxString& separator) const
 {
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    AllocationCounter allocationCounter;
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
     const size_t pageCount = m_pages->GetPageCount();
 
     wxArrayString values;
@@ -2764,6 +8270,14 @@ wxArrayString wxSystemInformationFrame::GetValues(const wxString& separator) con
         values.insert(values.end(), viewValues.begin(), viewValues.end());
     }
 
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    const AllocationCount allocationCount = allocationCounter.GetCount();
+    EventLoopView* eventLoopView = FindEventLoopView(m_pages);
+
+    if ( eventLoopView )
+        eventLoopView->AddAllocationCount("GetValues()", allocationCount);
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
     return values;
 }
 
@@ -2794,6 +8308,127 @@ WXLRESULT wxSystemInformationFrame::MSWWindowProc(WXUINT nMsg, WXWPARAM wParam,
 }
 #endif // #ifdef __WXMSW__
 
+void wxSystemInformationFrame::StartStallWatchdog()
+{
+    StopStallWatchdog();
+
+    m_stallWatchdogThread = new StallWatchdogThread(this, m_stallWatchdogDeadline);
+    if ( m_stallWatchdogThread->Run() != wxTHREAD_NO_ERROR )
+    {
+        delete m_stallWatchdogThread;
+        m_stallWatchdogThread = nullptr;
+        wxLogError(_("Could not create the stall watchdog thread."));
+    }
+}
+
+void wxSystemInformationFrame::StopStallWatchdog()
+{
+    if ( m_stallWatchdogThread )
+    {
+        m_stallWatchdogThread->Delete();
+        delete m_stallWatchdogThread;
+        m_stallWatchdogThread = nullptr;
+    }
+}
+
+#ifdef __WXGTK__
+
+namespace {
+
+// the GtkSettings properties the frame is notified about
+// and the views affected by their changes
+const struct
+{
+    const char* name;
+    long        views;
+} GTKSettingsProperties[] =
+{
+    { "gtk-theme-name",
+      wxSystemInformationFrame::ViewSystemColours | wxSystemInformationFrame::ViewSystemFonts
+      | wxSystemInformationFrame::ViewSystemMetrics | wxSystemInformationFrame::ViewMiscellaneous },
+    { "gtk-icon-theme-name",               wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-application-prefer-dark-theme",
+      wxSystemInformationFrame::ViewSystemColours | wxSystemInformationFrame::ViewMiscellaneous },
+    { "gtk-font-name",
+      wxSystemInformationFrame::ViewSystemFonts | wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-xft-dpi",
+      wxSystemInformationFrame::ViewSystemFonts | wxSystemInformationFrame::ViewSystemMetrics
+      | wxSystemInformationFrame::ViewDisplays },
+    { "gtk-xft-antialias",                 wxSystemInformationFrame::ViewSystemFonts },
+    { "gtk-xft-hinting",                   wxSystemInformationFrame::ViewSystemFonts },
+    { "gtk-xft-hintstyle",                 wxSystemInformationFrame::ViewSystemFonts },
+    { "gtk-xft-rgba",                      wxSystemInformationFrame::ViewSystemFonts },
+    { "gtk-cursor-theme-name",             wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-cursor-theme-size",             wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-cursor-blink",                  wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-cursor-blink-time",             wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-double-click-time",             wxSystemInformationFrame::ViewSystemMetrics },
+    { "gtk-double-click-distance",         wxSystemInformationFrame::ViewSystemMetrics },
+};
+
+} // anonymous namespace
+
+void wxSystemInformationFrame::ConnectGTKSettingsNotifications()
+{
+    GtkSettings* settings = gtk_settings_get_default();
+
+    if ( !settings )
+        return;
+
+    // the theme name may have changed while no frame was notified
+    s_GTKThemeName.clear();
+
+    for ( const auto& property : GTKSettingsProperties )
+    {
+        const wxString signalName = wxString::Format("notify::%s", property.name);
+
+        g_signal_connect(settings, signalName.utf8_str(), G_CALLBACK(OnGTKSettingsNotify), this);
+    }
+}
+
+void wxSystemInformationFrame::DisconnectGTKSettingsNotifications()
+{
+    GtkSettings* settings = gtk_settings_get_default();
+
+    if ( settings )
+        g_signal_handlers_disconnect_by_data(settings, this);
+}
+
+void wxSystemInformationFrame::OnGTKSettingsNotify(void* WXUNUSED(settings), void* paramSpec, void* frame)
+{
+    wxSystemInformationFrame* sysInfoFrame = static_cast<wxSystemInformationFrame*>(frame);
+    const wxString propertyName = wxString::FromUTF8(g_param_spec_get_name(static_cast<GParamSpec*>(paramSpec)));
+    long views = AllViews;
+
+    if ( propertyName == "gtk-theme-name" )
+        s_GTKThemeName.clear();
+
+    for ( const auto& property : GTKSettingsProperties )
+    {
+        if ( propertyName == property.name )
+        {
+            views = property.views;
+            break;
+        }
+    }
+
+    sysInfoFrame->LogInformation(wxString::Format("GtkSettings property \"%s\" changed.", propertyName));
+    sysInfoFrame->TriggerValuesUpdate(views);
+}
+#endif // #ifdef __WXGTK__
+
+void wxSystemInformationFrame::OnStallWatchdogPing(wxThreadEvent& event)
+{
+    // the ping can arrive from a thread which was already stopped
+    if ( m_stallWatchdogThread )
+        static_cast<StallWatchdogThread*>(m_stallWatchdogThread)->Answer(event.GetExtraLong());
+}
+
+void wxSystemInformationFrame::OnStallWatchdogStall(wxThreadEvent& event)
+{
+    LogInformation(event.GetString());
+}
+
 void wxSystemInformationFrame::LogInformation(const wxString& information)
 {
     wxString timeStampFormat = wxLog::GetTimestamp();
@@ -2812,20 +8447,27 @@ void wxSystemInformationFrame::LogInformation(const wxString& information)
         m_unloggedInformation.push_back(message);
 }
 
-void wxSystemInformationFrame::TriggerValuesUpdate()
+void wxSystemInformationFrame::TriggerValuesUpdate(long views)
 {
     if ( !m_autoRefresh )
         return;
 
+    m_pendingUpdateViews |= views;
+
     // prevent multiple updates for a batch of setting change messages/events
     const int updateTimerDuration = 750; // milliseconds
 
     m_valuesUpdateTimer.StartOnce(updateTimerDuration);
 }
 
-void wxSystemInformationFrame::UpdateValues()
+void wxSystemInformationFrame::UpdateValues(bool onEvent, long views)
 {
     const size_t pageCount = m_pages->GetPageCount();
+    wxStopWatch stopWatch;
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    AllocationCounter allocationCounter;
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
 
     {
         wxBusyCursor busyCursor;
@@ -2833,11 +8475,55 @@ void wxSystemInformationFrame::UpdateValues()
         for ( size_t i = 0; i < pageCount; ++i )
         {
             SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetPage(i));
-            view->UpdateValues();
+
+            if ( (view->GetViewFlag() & views) == 0 )
+                continue;
+
+            if ( onEvent )
+                view->UpdateValues(SysInfoListView::Volatility_OnEvent);
+            else
+                view->UpdateValues(SysInfoListView::Volatility_OnEvent | SysInfoListView::Volatility_Live);
+        }
+    }
+
+    const wxLongLong_t duration = stopWatch.TimeInMicro().GetValue();
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    const AllocationCount allocationCount = allocationCounter.GetCount();
+
+    m_updateValuesAllocationCount = allocationCount.count;
+#ifdef WX_SYSTEM_INFORMATION_FRAME_MAX_UPDATE_ALLOCATIONS
+    wxASSERT_MSG(allocationCount.count <= WX_SYSTEM_INFORMATION_FRAME_MAX_UPDATE_ALLOCATIONS,
+                 wxString::Format("Refreshing the values made %llu allocations, more than the maximum of %llu",
+                                  allocationCount.count,
+                                  static_cast<wxULongLong_t>(WX_SYSTEM_INFORMATION_FRAME_MAX_UPDATE_ALLOCATIONS)));
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_MAX_UPDATE_ALLOCATIONS
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    EventLoopView* eventLoopView = FindEventLoopView(m_pages);
+
+    if ( eventLoopView )
+    {
+        eventLoopView->AddUpdateValuesDuration(duration);
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+        eventLoopView->AddAllocationCount("UpdateValues()", allocationCount);
+
+        for ( size_t i = 0; i < pageCount; ++i )
+        {
+            const SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetPage(i));
+
+            eventLoopView->AddAllocationCount(wxString::Format("%s DoUpdateValues()", m_pages->GetPageText(i)),
+                view->GetUpdateValuesAllocationCount());
         }
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
     }
 
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    // also when there is no Event Loop page
+    LogInformation(wxString::Format(_("System values were refreshed with %llu allocations of %s."),
+                                    allocationCount.count, BytesToString(allocationCount.bytes)));
+#else
     LogInformation(_("System values were refreshed."));
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
 }
 
 void wxSystemInformationFrame::OnRefresh(wxCommandEvent&)
@@ -2879,12 +8565,94 @@ void wxSystemInformationFrame::OnSave(wxCommandEvent&)
     if ( !textFile.Create() )
         return;
 
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    AllocationCounter allocationCounter;
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+
     const wxArrayString values = GetValues();
 
     for ( const auto& value : values )
         textFile.AddLine(value);
 
     textFile.Write();
+
+#ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    const AllocationCount allocationCount = allocationCounter.GetCount();
+    EventLoopView* eventLoopView = FindEventLoopView(m_pages);
+
+    if ( eventLoopView )
+        eventLoopView->AddAllocationCount("OnSave()", allocationCount);
+#endif // #ifdef WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+}
+
+// searches from the selected item of the current page, through the following
+// pages, wrapping around to the beginning of the current page
+bool wxSystemInformationFrame::FindText(bool findNext)
+{
+    const wxString text = m_searchCtrl->GetValue().Lower();
+    const size_t pageCount = m_pages->GetPageCount();
+    const int currentPageIndex = m_pages->GetSelection();
+
+    if ( text.empty() || currentPageIndex == wxNOT_FOUND )
+        return false;
+
+    for ( size_t i = 0; i <= pageCount; ++i )
+    {
+        const size_t pageIndex = (currentPageIndex + i) % pageCount;
+        SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetPage(pageIndex));
+        long startItemIndex = 0;
+
+        if ( i == 0 )
+        {
+            startItemIndex = std::max(0L, view->GetFirstSelectedStoredItem());
+            if ( findNext && view->GetFirstSelectedStoredItem() != -1 )
+                ++startItemIndex;
+        }
+
+        const long itemIndex = view->FindItemWithText(text, startItemIndex);
+
+        if ( itemIndex == -1 )
+            continue;
+
+        if ( pageIndex != static_cast<size_t>(currentPageIndex) )
+            m_pages->SetSelection(pageIndex);
+
+        view->SelectStoredItem(itemIndex);
+        view->FocusStoredItem(itemIndex);
+        return true;
+    }
+
+    return false;
+}
+
+void wxSystemInformationFrame::OnFindText(wxCommandEvent&)
+{
+    FindText(false);
+}
+
+void wxSystemInformationFrame::OnFindNextText(wxCommandEvent&)
+{
+    if ( !FindText(true) )
+        wxBell();
+}
+
+void wxSystemInformationFrame::OnFilterText(wxCommandEvent&)
+{
+    SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetCurrentPage());
+
+    if ( view )
+        view->SetFilter(m_filterCtrl->GetValue());
+}
+
+void wxSystemInformationFrame::OnPageChanged(wxBookCtrlEvent& event)
+{
+    event.Skip();
+
+    const SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetCurrentPage());
+
+    // ChangeValue() does not send wxEVT_TEXT
+    if ( view )
+        m_filterCtrl->ChangeValue(view->GetFilter());
 }
 
 void wxSystemInformationFrame::OnClearLog(wxCommandEvent&)
@@ -2901,7 +8669,24 @@ void wxSystemInformationFrame::OnUpdateUI(wxUpdateUIEvent& event)
 
 void wxSystemInformationFrame::OnUpdateValuesTimer(wxTimerEvent&)
 {
-    UpdateValues();
+    const long views = m_pendingUpdateViews;
+
+    m_pendingUpdateViews = 0;
+    UpdateValues(true, views);
+}
+
+void wxSystemInformationFrame::OnSampleTimer(wxTimerEvent&)
+{
+    // only the current page can be shown, the other pages are paused
+    SysInfoListView* view = dynamic_cast<SysInfoListView*>(m_pages->GetCurrentPage());
+
+    if ( !view || IsIconized() || !view->IsShownOnScreen() )
+        return;
+
+    const int interval = view->GetSampleInterval(m_liveRefresh);
+
+    if ( interval > 0 )
+        view->SampleValues(m_sampleStopWatch.Time(), interval);
 }
 
 void wxSystemInformationFrame::OnSysColourChanged(wxSysColourChangedEvent& event)
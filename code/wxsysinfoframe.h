@@ -14,11 +14,22 @@
 #define WX_SYSTEM_INFORMATION_FRAME_VERSION_STRING "4.3"
 
 #include <wx/frame.h>
+#include <wx/stopwatch.h>
 #include <wx/timer.h>
 
 // avoid unnecessary includes
+class WXDLLIMPEXP_FWD_CORE wxBookCtrlEvent;
 class WXDLLIMPEXP_FWD_CORE wxNotebook;
+class WXDLLIMPEXP_FWD_CORE wxSearchCtrl;
 class WXDLLIMPEXP_FWD_CORE wxTextCtrl;
+class WXDLLIMPEXP_FWD_BASE wxThread;
+
+// When wxsysinfoframe.cpp is compiled with WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+// defined, the global operator new and delete are replaced with ones counting
+// the allocations, and the allocations made by refreshing, obtaining and saving
+// the values are shown on the Event Loop page. Meant only for measurements.
+// When also WX_SYSTEM_INFORMATION_FRAME_MAX_UPDATE_ALLOCATIONS is defined as a number,
+// refreshing the values of all the pages with more allocations fails an assert.
 
 class wxSystemInformationFrame : public wxFrame
 {
@@ -29,6 +40,11 @@ public:
         // certain WM_* messages
         AutoRefresh = 1,
 
+        // whether the values which can change any time are periodically
+        // refreshed also on the pages which do not sample them on their own;
+        // the pages are refreshed only while shown and the frame is not minimized
+        LiveRefresh = 1 << 30,
+
         // whether to display these pages with values, at least one of these
         // must be specified when creating wxSystemInformationFrame
         ViewSystemColours        = 1 << 1,
@@ -40,13 +56,44 @@ public:
         ViewEnvironmentVariables = 1 << 7,
         ViewMiscellaneous        = 1 << 8,
         ViewPreprocessorDefines  = 1 << 9,
+
+        // these pages are available only on Linux,
+        // the flags are ignored on other platforms
+        ViewCPUTopology          = 1 << 10,
+        ViewNUMA                 = 1 << 11,
+        ViewCGroup               = 1 << 12,
+        ViewProcessResources     = 1 << 13,
+        ViewThreads              = 1 << 14,
+        ViewMemory               = 1 << 16,
+        ViewPressure             = 1 << 17,
+        ViewCPUUsage             = 1 << 18,
+        ViewKernel               = 1 << 19,
+        ViewStorage              = 1 << 21,
+        ViewNetwork              = 1 << 22,
+        ViewFileDescriptors      = 1 << 23,
+        ViewModules              = 1 << 24,
+        // requires glibc
+        ViewHeap                 = 1 << 25,
+
+        // this page is available only on Unix-like platforms,
+        // the flag is ignored on other platforms
+        ViewResourceLimits       = 1 << 20,
+
+        // instrumentation of the hosting application, it measures
+        // the latency of its event loop even when the page is not shown
+        ViewEventLoop            = 1 << 15,
     };
 
     static const long DefaultCreateFlags = AutoRefresh
                                            | ViewSystemColours | ViewSystemFonts | ViewSystemMetrics
                                            | ViewDisplays | ViewStandardPaths | ViewSystemOptions
                                            | ViewEnvironmentVariables | ViewMiscellaneous
-                                           | ViewPreprocessorDefines;
+                                           | ViewPreprocessorDefines
+                                           | ViewCPUTopology | ViewNUMA | ViewCGroup
+                                           | ViewProcessResources | ViewThreads | ViewMemory
+                                           | ViewPressure | ViewCPUUsage | ViewKernel
+                                           | ViewStorage | ViewNetwork | ViewFileDescriptors
+                                           | ViewModules | ViewHeap | ViewResourceLimits;
 
 
     wxSystemInformationFrame(wxWindow *parent, wxWindowID id, const wxString &title,
@@ -60,6 +107,8 @@ public:
     wxSystemInformationFrame(wxWindow* parent, const wxSize& size = wxSize(1024, 800),
                              long createFlags = DefaultCreateFlags);
 
+    ~wxSystemInformationFrame();
+
     bool Create(wxWindow *parent, wxWindowID id, const wxString &title,
                 const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxDefaultSize,
                 long frameStyle = wxDEFAULT_FRAME_STYLE,
@@ -72,34 +121,96 @@ public:
     // therefore value for each parameter.
     wxArrayString GetValues(const wxString& separator = "\t") const;
 
+    // The stall watchdog is a thread periodically checking whether the main
+    // thread responds within the deadline (in milliseconds), the stalls are
+    // written to the log, on Linux with glibc with the main thread backtrace.
+    // The watchdog is off by default, deadline 0 turns it off.
+    void SetStallWatchdogDeadline(int deadline);
+    int GetStallWatchdogDeadline() const { return m_stallWatchdogDeadline; }
+
+    // the number of allocations made by the last refresh of the values of all
+    // the pages, e.g. by RefreshValues(), so that a test or benchmark can check it;
+    // always 0 unless compiled with WX_SYSTEM_INFORMATION_FRAME_COUNT_ALLOCATIONS
+    wxULongLong_t GetUpdateValuesAllocationCount() const { return m_updateValuesAllocationCount; }
+
+    // see LiveRefresh in CreateFlags
+    void SetLiveRefresh(bool liveRefresh) { m_liveRefresh = liveRefresh; }
+    bool IsLiveRefresh() const { return m_liveRefresh; }
+
 #ifdef __WXMSW__ // for WM_* messages
     WXLRESULT MSWWindowProc(WXUINT nMsg, WXWPARAM wParam, WXLPARAM lParam) override;
 #endif // #ifdef __WXMSW__
 
 private:
     bool m_autoRefresh{true};
+    bool m_liveRefresh{false};
+
+    wxULongLong_t m_updateValuesAllocationCount{0};
 
-    wxNotebook* m_pages{nullptr};
-    wxTextCtrl* m_logCtrl{nullptr};
+    wxNotebook*   m_pages{nullptr};
+    wxTextCtrl*   m_logCtrl{nullptr};
+    wxSearchCtrl* m_searchCtrl{nullptr};
+    wxSearchCtrl* m_filterCtrl{nullptr};
 
     wxTimer m_valuesUpdateTimer;
 
+    // the resolution of the page sample intervals, in milliseconds
+    static const int SampleTimerInterval = 250;
+
+    wxTimer     m_sampleTimer;
+    wxStopWatch m_sampleStopWatch;
+
     wxArrayString m_unloggedInformation;
 
+    int       m_stallWatchdogDeadline{0};
+    wxThread* m_stallWatchdogThread{nullptr};
+
+    void StartStallWatchdog();
+    void StopStallWatchdog();
+
+#ifdef __WXGTK__
+    // GtkSettings property change notifications, GTK does not send
+    // any other events for many of the changes, such as the theme
+    void ConnectGTKSettingsNotifications();
+    void DisconnectGTKSettingsNotifications();
+    // the parameters are GtkSettings*, GParamSpec*, and wxSystemInformationFrame*
+    static void OnGTKSettingsNotify(void* settings, void* paramSpec, void* frame);
+#endif // #ifdef __WXGTK__
+
     void LogInformation(const wxString& information);
 
-    void TriggerValuesUpdate();
-    void UpdateValues();
+    // returns true if an item containing the text in the search control was found
+    bool FindText(bool findNext);
+
+    // all the View* values of CreateFlags
+    static const long AllViews = ~0L;
+
+    // the views to update when m_valuesUpdateTimer fires
+    long m_pendingUpdateViews{0};
+
+    // views are View* values of CreateFlags affected by the change
+    void TriggerValuesUpdate(long views = AllViews);
+    // onEvent is true when the update was triggered by a system setting change,
+    // then only the values which can change in response to it are updated;
+    // views are View* values of CreateFlags
+    void UpdateValues(bool onEvent = false, long views = AllViews);
 
     void OnRefresh(wxCommandEvent&);
     void OnShowDetailedInformation(wxCommandEvent&);
     void OnShowwxInfoMessageBox(wxCommandEvent&);
     void OnSave(wxCommandEvent&);
+    void OnFindText(wxCommandEvent&);
+    void OnFindNextText(wxCommandEvent&);
+    void OnFilterText(wxCommandEvent&);
+    void OnPageChanged(wxBookCtrlEvent& event);
     void OnClearLog(wxCommandEvent&);
     void OnUpdateUI(wxUpdateUIEvent& event);
     void OnUpdateValuesTimer(wxTimerEvent&);
+    void OnSampleTimer(wxTimerEvent&);
     void OnSysColourChanged(wxSysColourChangedEvent& event);
     void OnDisplayChanged(wxDisplayChangedEvent& event);
+    void OnStallWatchdogPing(wxThreadEvent& event);
+    void OnStallWatchdogStall(wxThreadEvent& event);
 #if wxCHECK_VERSION(3, 1, 3)
     void OnDPIChanged(wxDPIChangedEvent& event);
 #endif